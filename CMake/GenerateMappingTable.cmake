@@ -0,0 +1,185 @@
+# Usage:
+# cmake -P GenerateMappingTable.cmake <path/to/mappings.h> <path/to/mapping_table.h>
+
+cmake_policy(VERSION 3.16)
+
+set(source_path "${CMAKE_ARGV3}")
+set(target_path "${CMAKE_ARGV4}")
+
+if (NOT EXISTS "${source_path}")
+    message(FATAL_ERROR "Failed to find mappings file ${source_path}")
+endif()
+
+# The platform name and GUID conversion used by the joystick backend of each
+# section of mappings.h, as this script has to do what parseMapping would
+set(_GLFW_WIN32_platform "Windows")
+set(_GLFW_COCOA_platform "Mac OS X")
+set(GLFW_BUILD_LINUX_JOYSTICK_platform "Linux")
+set(GLFW_BUILD_OS4_JOYSTICK_platform "AmigaOS4")
+
+set(button_fields a b x y leftshoulder rightshoulder back start guide
+                  leftstick rightstick dpup dpright dpdown dpleft)
+set(axis_fields leftx lefty rightx righty lefttrigger righttrigger)
+
+# Converts a mapping GUID to the form used by the platform for joysticks
+function(normalize_guid section guid_var)
+    string(TOLOWER "${${guid_var}}" guid)
+    if (section STREQUAL "_GLFW_WIN32")
+        if (guid MATCHES "^(....)(....).*504944564944$")
+            set(guid "03000000${CMAKE_MATCH_1}0000${CMAKE_MATCH_2}000000000000")
+        endif()
+    elseif (section STREQUAL "_GLFW_COCOA")
+        if (guid MATCHES "^(....)000000000000(....)000000000000$")
+            set(guid "03000000${CMAKE_MATCH_1}0000${CMAKE_MATCH_2}000000000000")
+        endif()
+    endif()
+    set(${guid_var} "${guid}" PARENT_SCOPE)
+endfunction()
+
+# Parses an SDL_GameControllerDB line into a mapping initializer
+# The entry variable is left empty if parseMapping would reject the line
+function(parse_mapping section line guid_var entry_var)
+    set(${entry_var} "" PARENT_SCOPE)
+
+    string(REPLACE "," ";" fields "${line}")
+    list(LENGTH fields field_count)
+    if (field_count LESS 2)
+        return()
+    endif()
+
+    list(GET fields 0 guid)
+    list(GET fields 1 name)
+    list(REMOVE_AT fields 0 1)
+
+    string(LENGTH "${guid}" length)
+    if (NOT length EQUAL 32)
+        return()
+    endif()
+
+    string(LENGTH "${name}" length)
+    if (length GREATER_EQUAL 128)
+        return()
+    endif()
+
+    foreach(field IN LISTS button_fields axis_fields)
+        set(element_${field} "{ 0, 0, 0, 0 }")
+    endforeach()
+
+    foreach(field IN LISTS fields)
+        if (field MATCHES "^[+-]")
+            return()
+        endif()
+
+        if (NOT field MATCHES "^([a-z]+):(.*)$")
+            continue()
+        endif()
+
+        set(key "${CMAKE_MATCH_1}")
+        set(value "${CMAKE_MATCH_2}")
+
+        if (key STREQUAL "platform")
+            if (NOT value MATCHES "^${${section}_platform}")
+                return()
+            endif()
+            continue()
+        endif()
+
+        if (NOT DEFINED element_${key})
+            continue()
+        endif()
+
+        set(minimum -1)
+        set(maximum 1)
+
+        if (value MATCHES "^\\+(.*)$")
+            set(minimum 0)
+            set(value "${CMAKE_MATCH_1}")
+        elseif (value MATCHES "^-(.*)$")
+            set(maximum 0)
+            set(value "${CMAKE_MATCH_1}")
+        endif()
+
+        if (value MATCHES "^a([0-9]*)(~?)")
+            math(EXPR scale "2 / (${maximum} - ${minimum})")
+            math(EXPR offset "-(${maximum} + ${minimum})")
+            if (CMAKE_MATCH_2)
+                math(EXPR scale "-(${scale})")
+                math(EXPR offset "-(${offset})")
+            endif()
+            math(EXPR index "0${CMAKE_MATCH_1} & 255")
+            set(element_${key} "{ _GLFW_JOYSTICK_AXIS, ${index}, ${scale}, ${offset} }")
+        elseif (value MATCHES "^b([0-9]*)")
+            math(EXPR index "0${CMAKE_MATCH_1} & 255")
+            set(element_${key} "{ _GLFW_JOYSTICK_BUTTON, ${index}, 0, 0 }")
+        elseif (value MATCHES "^h([0-9]*)\\.([0-9]*)")
+            math(EXPR index "((0${CMAKE_MATCH_1} << 4) | 0${CMAKE_MATCH_2}) & 255")
+            set(element_${key} "{ _GLFW_JOYSTICK_HATBIT, ${index}, 0, 0 }")
+        endif()
+    endforeach()
+
+    normalize_guid(${section} guid)
+
+    set(buttons "")
+    foreach(field IN LISTS button_fields)
+        string(APPEND buttons " ${element_${field}},")
+    endforeach()
+
+    set(axes "")
+    foreach(field IN LISTS axis_fields)
+        string(APPEND axes " ${element_${field}},")
+    endforeach()
+
+    set(${guid_var} "${guid}" PARENT_SCOPE)
+    set(${entry_var} "{ \"${name}\", \"${guid}\",\n  {${buttons} },\n  {${axes} } }," PARENT_SCOPE)
+endfunction()
+
+file(STRINGS "${source_path}" lines)
+
+set(section "")
+set(table "")
+
+foreach(line IN LISTS lines)
+    if (line MATCHES "^#if defined\\(([A-Za-z0-9_]+)\\)")
+        set(section "${CMAKE_MATCH_1}")
+        set(entries "")
+        set(number 0)
+    elseif (line MATCHES "^#endif" AND section)
+        # Equal GUIDs keep their original order so the first valid one wins
+        list(SORT entries)
+        string(APPEND table "#if defined(${section})\n")
+        foreach(entry IN LISTS entries)
+            string(SUBSTRING "${entry}" 37 -1 entry)
+            string(APPEND table "${entry}\n")
+        endforeach()
+        string(APPEND table "#endif // ${section}\n\n")
+        set(section "")
+    elseif (section AND line MATCHES "^\"(.*)\",$")
+        parse_mapping(${section} "${CMAKE_MATCH_1}" guid entry)
+        if (entry)
+            math(EXPR number "${number} + 1")
+            string(LENGTH "${number}" length)
+            math(EXPR length "5 - ${length}")
+            string(REPEAT "0" ${length} padding)
+            list(APPEND entries "${guid}${padding}${number}${entry}")
+        endif()
+    endif()
+endforeach()
+
+if (section)
+    message(FATAL_ERROR "Unterminated section ${section} in ${source_path}")
+endif()
+
+set(content
+"// This file is generated from mappings.h by GenerateMappingTable.cmake.
+// Each section holds the valid mappings of that section of mappings.h,
+// pre-parsed and sorted by GUID.  The table ends with an empty entry, so it
+// is never empty even if no section applies.  Do not edit this file.
+
+const _GLFWmapping _glfwDefaultMappingTable[] =
+{
+${table}{ \"\", \"\" }
+};
+
+")
+
+file(WRITE "${target_path}" "${content}")
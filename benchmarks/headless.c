@@ -0,0 +1,451 @@
+//========================================================================
+// Headless benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This benchmark drives synthetic input events through the shared input code
+// and creates and destroys windows on the null platform, so the hot paths of
+// GLFW can be measured without a display or GPU
+//
+// It uses the internal API and so must be linked with a static library built
+// from the same sources
+//
+//========================================================================
+
+#include "internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "getopt.h"
+
+enum
+{
+    DELIVER_NONE,
+    DELIVER_CALLBACK,
+    DELIVER_QUEUE,
+    DELIVER_COALESCE
+};
+
+static const char* delivery_names[] =
+{
+    "none",
+    "callback",
+    "queue",
+    "coalesce"
+};
+
+enum
+{
+    EVENT_KEY,
+    EVENT_CHAR,
+    EVENT_MOUSE_BUTTON,
+    EVENT_CURSOR_POS,
+    EVENT_SCROLL
+};
+
+static const char* event_names[] =
+{
+    "key",
+    "char",
+    "mouse button",
+    "cursor pos",
+    "scroll"
+};
+
+static unsigned long allocations = 0;
+static unsigned long callbacks = 0;
+
+static void usage(void)
+{
+    printf("Usage: headless [-h] [-n EVENTS] [-f EVENTS] [-p POLLS] [-w WINDOWS] [-c CYCLES]\n");
+    printf("Options:\n");
+    printf("  -n the number of events per input benchmark\n");
+    printf("  -f the number of events per event processing pass\n");
+    printf("  -p the number of timed event processing passes\n");
+    printf("  -w the number of windows during event processing\n");
+    printf("  -c the number of window create and destroy cycles\n");
+    printf("  -h show this help\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void* allocate(size_t size, void* user)
+{
+    allocations++;
+    return malloc(size);
+}
+
+static void* reallocate(void* block, size_t size, void* user)
+{
+    allocations++;
+    return realloc(block, size);
+}
+
+static void deallocate(void* block, void* user)
+{
+    free(block);
+}
+
+static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    callbacks++;
+}
+
+static void char_callback(GLFWwindow* window, unsigned int codepoint)
+{
+    callbacks++;
+}
+
+static void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
+{
+    callbacks++;
+}
+
+static void cursor_position_callback(GLFWwindow* window, double x, double y)
+{
+    callbacks++;
+}
+
+static void scroll_callback(GLFWwindow* window, double x, double y)
+{
+    callbacks++;
+}
+
+static double get_seconds(uint64_t ticks)
+{
+    return (double) ticks / (double) glfwGetTimerFrequency();
+}
+
+static int compare_ticks(const void* first, const void* second)
+{
+    const uint64_t a = *((const uint64_t*) first);
+    const uint64_t b = *((const uint64_t*) second);
+    return (a > b) - (a < b);
+}
+
+static GLFWwindow* create_window(void)
+{
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    return glfwCreateWindow(640, 480, "Headless Benchmark", NULL, NULL);
+}
+
+static void set_delivery(GLFWwindow* window, int delivery)
+{
+    if (delivery == DELIVER_NONE)
+    {
+        glfwSetKeyCallback(window, NULL);
+        glfwSetCharCallback(window, NULL);
+        glfwSetMouseButtonCallback(window, NULL);
+        glfwSetCursorPosCallback(window, NULL);
+        glfwSetScrollCallback(window, NULL);
+    }
+    else
+    {
+        glfwSetKeyCallback(window, key_callback);
+        glfwSetCharCallback(window, char_callback);
+        glfwSetMouseButtonCallback(window, mouse_button_callback);
+        glfwSetCursorPosCallback(window, cursor_position_callback);
+        glfwSetScrollCallback(window, scroll_callback);
+    }
+
+    glfwSetInputMode(window, GLFW_EVENT_QUEUE, delivery == DELIVER_QUEUE);
+    glfwSetInputMode(window, GLFW_COALESCE_CURSOR_MOTION, delivery == DELIVER_COALESCE);
+}
+
+static void input_event(_GLFWwindow* window, int type, int i)
+{
+    switch (type)
+    {
+        case EVENT_KEY:
+            _glfwInputKey(window, GLFW_KEY_A + (i / 2) % 26, i / 2,
+                          (i & 1) ? GLFW_RELEASE : GLFW_PRESS, 0);
+            break;
+        case EVENT_CHAR:
+            _glfwInputChar(window, 'a' + i % 26, 0, GLFW_TRUE);
+            break;
+        case EVENT_MOUSE_BUTTON:
+            _glfwInputMouseClick(window, (i / 2) % (GLFW_MOUSE_BUTTON_LAST + 1),
+                                 (i & 1) ? GLFW_RELEASE : GLFW_PRESS, 0);
+            break;
+        case EVENT_CURSOR_POS:
+            _glfwInputCursorPos(window, i % 1000, (i / 1000) % 1000);
+            break;
+        case EVENT_SCROLL:
+            _glfwInputScroll(window, 0.0, (i & 1) ? 1.0 : -1.0);
+            break;
+    }
+}
+
+// Passes synthetic events of the specified type to the window, with an event
+// processing pass after every frame of events, and returns the time taken
+//
+static double run_input(GLFWwindow* handle, int type, int count, int frame)
+{
+    GLFWevent events[256];
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    const uint64_t start = glfwGetTimerValue();
+    int i;
+
+    for (i = 0;  i < count;  i++)
+    {
+        input_event(window, type, i);
+
+        if ((i + 1) % frame == 0)
+        {
+            glfwPollEvents();
+            while (glfwGetEvents(handle, events, 256))
+                ;
+        }
+    }
+
+    glfwPollEvents();
+    while (glfwGetEvents(handle, events, 256))
+        ;
+
+    return get_seconds(glfwGetTimerValue() - start);
+}
+
+static void benchmark_input(int count, int frame)
+{
+    int type, delivery;
+    GLFWwindow* window = create_window();
+    if (!window)
+        return;
+
+    printf("\nInput events (%i events, %i events per pass)\n", count, frame);
+    printf("%-14s %-10s %14s %10s %10s %12s %12s\n",
+           "event", "delivery", "events/s", "ns/event", "overhead",
+           "allocs/event", "calls/event");
+
+    for (type = EVENT_KEY;  type <= EVENT_SCROLL;  type++)
+    {
+        double baseline = 0.0;
+
+        for (delivery = DELIVER_NONE;  delivery <= DELIVER_COALESCE;  delivery++)
+        {
+            unsigned long first_allocations;
+            double seconds, ns;
+
+            if (delivery == DELIVER_COALESCE && type != EVENT_CURSOR_POS)
+                continue;
+
+            set_delivery(window, delivery);
+
+            // Warm up so that lazy allocations are not counted
+            run_input(window, type, frame, frame);
+
+            first_allocations = allocations;
+            callbacks = 0;
+
+            seconds = run_input(window, type, count, frame);
+            ns = seconds * 1e9 / count;
+            if (delivery == DELIVER_NONE)
+                baseline = ns;
+
+            printf("%-14s %-10s %14.0f %10.2f %10.2f %12.4f %12.4f\n",
+                   event_names[type], delivery_names[delivery],
+                   count / seconds, ns, ns - baseline,
+                   (double) (allocations - first_allocations) / count,
+                   (double) callbacks / count);
+        }
+    }
+
+    set_delivery(window, DELIVER_NONE);
+    glfwDestroyWindow(window);
+}
+
+static void print_latency(const char* name, uint64_t* samples, int count)
+{
+    const double scale = 1e9 / (double) glfwGetTimerFrequency();
+
+    qsort(samples, count, sizeof(uint64_t), compare_ticks);
+
+    printf("%-34s %10.0f %10.0f %10.0f %10.0f %10.0f\n",
+           name,
+           samples[count / 2] * scale,
+           samples[count * 9 / 10] * scale,
+           samples[count * 99 / 100] * scale,
+           samples[count * 999 / 1000] * scale,
+           samples[count - 1] * scale);
+}
+
+static void benchmark_latency(int count, int window_count)
+{
+    int i, j;
+    GLFWwindow** windows = calloc(window_count, sizeof(GLFWwindow*));
+    uint64_t* samples = calloc(count, sizeof(uint64_t));
+
+    for (i = 0;  i < window_count;  i++)
+    {
+        windows[i] = create_window();
+        if (!windows[i])
+            break;
+
+        set_delivery(windows[i], DELIVER_CALLBACK);
+    }
+
+    window_count = i;
+
+    printf("\nEvent processing latency (%i passes, %i windows, ns)\n",
+           count, window_count);
+    printf("%-34s %10s %10s %10s %10s %10s\n",
+           "function", "p50", "p90", "p99", "p99.9", "max");
+
+    for (i = 0;  i < count;  i++)
+    {
+        const uint64_t start = glfwGetTimerValue();
+        glfwPollEvents();
+        samples[i] = glfwGetTimerValue() - start;
+    }
+
+    print_latency("glfwPollEvents", samples, count);
+
+    for (i = 0;  i < count;  i++)
+    {
+        const uint64_t start = glfwGetTimerValue();
+        glfwWaitEventsTimeout(0.0);
+        samples[i] = glfwGetTimerValue() - start;
+    }
+
+    print_latency("glfwWaitEventsTimeout(0)", samples, count);
+
+    for (i = 0;  i < window_count;  i++)
+        set_delivery(windows[i], DELIVER_COALESCE);
+
+    for (i = 0;  i < count;  i++)
+    {
+        uint64_t start;
+
+        for (j = 0;  j < window_count;  j++)
+            _glfwInputCursorPos((_GLFWwindow*) windows[j], i, j);
+
+        start = glfwGetTimerValue();
+        glfwPollEvents();
+        samples[i] = glfwGetTimerValue() - start;
+    }
+
+    print_latency("glfwPollEvents (coalesced motion)", samples, count);
+
+    for (i = 0;  i < window_count;  i++)
+        glfwDestroyWindow(windows[i]);
+
+    free(samples);
+    free(windows);
+}
+
+static void benchmark_windows(int count)
+{
+    int i;
+    unsigned long first_allocations = allocations;
+    const uint64_t start = glfwGetTimerValue();
+    double seconds;
+
+    for (i = 0;  i < count;  i++)
+    {
+        GLFWwindow* window = create_window();
+        if (!window)
+            break;
+
+        glfwDestroyWindow(window);
+    }
+
+    if (!i)
+        return;
+
+    seconds = get_seconds(glfwGetTimerValue() - start);
+
+    printf("\nWindow create and destroy (%i cycles)\n", i);
+    printf("%-14s %14s %10s %12s\n", "operation", "cycles/s", "us/cycle", "allocs/cycle");
+    printf("%-14s %14.0f %10.2f %12.2f\n",
+           "cycle", i / seconds, seconds * 1e6 / i,
+           (double) (allocations - first_allocations) / i);
+}
+
+int main(int argc, char** argv)
+{
+    int ch;
+    int event_count = 1000000;
+    int frame_size = 1000;
+    int poll_count = 100000;
+    int window_count = 4;
+    int cycle_count = 10000;
+    const GLFWallocator allocator = { allocate, reallocate, deallocate, NULL };
+
+    while ((ch = getopt(argc, argv, "hn:f:p:w:c:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                event_count = atoi(optarg);
+                break;
+            case 'f':
+                frame_size = atoi(optarg);
+                break;
+            case 'p':
+                poll_count = atoi(optarg);
+                break;
+            case 'w':
+                window_count = atoi(optarg);
+                break;
+            case 'c':
+                cycle_count = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (event_count < 1 || frame_size < 1 || poll_count < 1 ||
+        window_count < 1 || cycle_count < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitAllocator(&allocator);
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    printf("GLFW %s\n", glfwGetVersionString());
+
+    benchmark_input(event_count, frame_size);
+    benchmark_latency(poll_count, window_count);
+    benchmark_windows(cycle_count);
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,258 @@
+//========================================================================
+// Pixel conversion benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This benchmark checks the pixel conversion functions used for window icons,
+// cursors and shared memory buffers against a scalar reference for every
+// color and alpha pair and every tail length, and then measures their
+// throughput against that reference
+//
+// It uses the internal API and so must be linked with a static library built
+// from the same sources
+//
+//========================================================================
+
+#include "internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "getopt.h"
+
+enum
+{
+    CONVERT,
+    PREMULTIPLY,
+    WIDEN
+};
+
+static const char* conversion_names[] =
+{
+    "convert",
+    "premultiply",
+    "widen"
+};
+
+static void usage(void)
+{
+    printf("Usage: pixels [-h] [-s SIZE] [-n PASSES]\n");
+    printf("Options:\n");
+    printf("  -s the width and height of the timed images\n");
+    printf("  -n the number of timed conversions\n");
+    printf("  -h show this help\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static double get_seconds(uint64_t ticks)
+{
+    return (double) ticks / (double) glfwGetTimerFrequency();
+}
+
+// The per-pixel conversions the backends used before the shared functions
+//
+static void reference_pixels(int type, void* target, const unsigned char* source, int count)
+{
+    int i;
+
+    for (i = 0;  i < count;  i++, source += 4)
+    {
+        const unsigned int alpha = source[3];
+        uint32_t word;
+
+        if (type == PREMULTIPLY)
+        {
+            word = (alpha << 24) |
+                   ((unsigned char) ((source[0] * alpha) / 255) << 16) |
+                   ((unsigned char) ((source[1] * alpha) / 255) <<  8) |
+                   ((unsigned char) ((source[2] * alpha) / 255) <<  0);
+        }
+        else
+        {
+            word = (alpha << 24) |
+                   ((uint32_t) source[0] << 16) |
+                   ((uint32_t) source[1] <<  8) |
+                   ((uint32_t) source[2] <<  0);
+        }
+
+        if (type == WIDEN)
+            ((unsigned long*) target)[i] = word;
+        else
+            ((uint32_t*) target)[i] = word;
+    }
+}
+
+static void convert_pixels(int type, void* target, const unsigned char* source, int count)
+{
+    if (type == CONVERT)
+        _glfwConvertPixels(target, source, count);
+    else if (type == PREMULTIPLY)
+        _glfwPremultiplyPixels(target, source, count);
+    else
+        _glfwWidenPixels(target, source, count);
+}
+
+static size_t get_pixel_size(int type)
+{
+    return type == WIDEN ? sizeof(unsigned long) : sizeof(uint32_t);
+}
+
+// Checks the conversion against the reference for every color and alpha pair,
+// starting at every offset so that every kernel tail is covered
+//
+static int check_pixels(int type)
+{
+    const int count = 256 * 256;
+    const size_t size = get_pixel_size(type);
+    unsigned char* source = malloc(count * 4 + 64 * 4);
+    unsigned char* expected = malloc((count + 64) * size);
+    unsigned char* actual = malloc((count + 64) * size);
+    int i, offset, result = GLFW_TRUE;
+
+    for (i = 0;  i < count + 64;  i++)
+    {
+        source[i * 4 + 0] = (unsigned char) (i % 256);
+        source[i * 4 + 1] = (unsigned char) (255 - i % 256);
+        source[i * 4 + 2] = (unsigned char) ((i * 7) % 256);
+        source[i * 4 + 3] = (unsigned char) ((i / 256) % 256);
+    }
+
+    for (offset = 0;  offset < 64;  offset++)
+    {
+        reference_pixels(type, expected, source + offset * 4, count - offset);
+        convert_pixels(type, actual, source + offset * 4, count - offset);
+
+        if (memcmp(expected, actual, (count - offset) * size) != 0)
+        {
+            result = GLFW_FALSE;
+            break;
+        }
+    }
+
+    free(source);
+    free(expected);
+    free(actual);
+    return result;
+}
+
+static void benchmark_pixels(int size, int passes)
+{
+    const int count = size * size;
+    unsigned char* source = malloc(count * 4);
+    void* target = malloc(count * sizeof(unsigned long));
+    int type, i;
+
+    for (i = 0;  i < count * 4;  i++)
+        source[i] = (unsigned char) rand();
+
+    printf("\nPixel conversion (%ix%i pixels, %i passes)\n", size, size, passes);
+    printf("%-12s %-8s %14s %14s %10s\n",
+           "conversion", "check", "reference/s", "pixels/s", "speedup");
+
+    for (type = CONVERT;  type <= WIDEN;  type++)
+    {
+        uint64_t start;
+        double reference, shared;
+
+        const int valid = check_pixels(type);
+
+        start = glfwGetTimerValue();
+        for (i = 0;  i < passes;  i++)
+            reference_pixels(type, target, source, count);
+        reference = get_seconds(glfwGetTimerValue() - start);
+
+        start = glfwGetTimerValue();
+        for (i = 0;  i < passes;  i++)
+            convert_pixels(type, target, source, count);
+        shared = get_seconds(glfwGetTimerValue() - start);
+
+        printf("%-12s %-8s %14.0f %14.0f %10.2f\n",
+               conversion_names[type], valid ? "ok" : "FAILED",
+               (double) count * passes / reference,
+               (double) count * passes / shared,
+               reference / shared);
+
+        if (!valid)
+        {
+            free(source);
+            free(target);
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    free(source);
+    free(target);
+}
+
+int main(int argc, char** argv)
+{
+    int ch;
+    int size = 256;
+    int passes = 1000;
+
+    while ((ch = getopt(argc, argv, "hs:n:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 's':
+                size = atoi(optarg);
+                break;
+            case 'n':
+                passes = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (size < 1 || passes < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    printf("GLFW %s\n", glfwGetVersionString());
+
+    benchmark_pixels(size, passes);
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
+
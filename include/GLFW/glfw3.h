@@ -1102,6 +1102,11 @@ extern "C" {
  *  [window hint](@ref GLFW_SCALE_FRAMEBUFFER_hint).
  */
 #define GLFW_SCALE_FRAMEBUFFER      0x0002200D
+/*! @brief Asynchronous readback depth hint.
+ *
+ *  Asynchronous readback depth [window hint](@ref GLFW_READBACK_BUFFERS_hint).
+ */
+#define GLFW_READBACK_BUFFERS       0x0002200E
 /*! @brief Legacy name for compatibility.
  *
  *  This is an alias for the
@@ -1155,6 +1160,9 @@ extern "C" {
 #define GLFW_LOCK_KEY_MODS           0x00033004
 #define GLFW_RAW_MOUSE_MOTION        0x00033005
 #define GLFW_UNLIMITED_MOUSE_BUTTONS 0x00033006
+#define GLFW_EVENT_QUEUE             0x00033007
+#define GLFW_COALESCE_CURSOR_MOTION  0x00033008
+#define GLFW_CURSOR_MOTION_HISTORY   0x00033009
 
 #define GLFW_CURSOR_NORMAL          0x00034001
 #define GLFW_CURSOR_HIDDEN          0x00034002
@@ -1323,6 +1331,16 @@ extern "C" {
  *  X11 specific [init hint](@ref GLFW_X11_XCB_VULKAN_SURFACE_hint).
  */
 #define GLFW_X11_XCB_VULKAN_SURFACE 0x00052001
+/*! @brief X11 specific init hint.
+ *
+ *  X11 specific [init hint](@ref GLFW_X11_EVENT_BUDGET_hint).
+ */
+#define GLFW_X11_EVENT_BUDGET       0x00052002
+/*! @brief X11 specific init hint.
+ *
+ *  X11 specific [init hint](@ref GLFW_X11_EVENT_TIME_BUDGET_hint).
+ */
+#define GLFW_X11_EVENT_TIME_BUDGET  0x00052003
 /*! @brief Wayland specific init hint.
  *
  *  Wayland specific [init hint](@ref GLFW_WAYLAND_LIBDECOR_hint).
@@ -1345,6 +1363,102 @@ extern "C" {
 #define GLFW_PLATFORM_OS4           0x00060006
 /*! @} */
 
+/*! @defgroup event_types Event types
+ *  @brief Event types reported by the event queue.
+ *
+ *  These are the types of the records returned by @ref glfwGetEvents when the
+ *  [event queue](@ref event_queue) is enabled for a window.
+ *
+ *  @ingroup input
+ *  @{ */
+/*! @brief A physical key was pressed, repeated or released.
+ */
+#define GLFW_EVENT_KEY              0x00070001
+/*! @brief A Unicode character was input.
+ */
+#define GLFW_EVENT_CHAR             0x00070002
+/*! @brief A mouse button was pressed or released.
+ */
+#define GLFW_EVENT_MOUSE_BUTTON     0x00070003
+/*! @brief The cursor was moved.
+ */
+#define GLFW_EVENT_CURSOR_POS       0x00070004
+/*! @brief The cursor entered or left the content area.
+ */
+#define GLFW_EVENT_CURSOR_ENTER     0x00070005
+/*! @brief A scroll device was used.
+ */
+#define GLFW_EVENT_SCROLL           0x00070006
+/*! @} */
+
+/*! @defgroup counters Instrumentation counters
+ *  @brief Counters reported by glfwGetCounter.
+ *
+ *  These are the [instrumentation counters](@ref instrumentation) that can be
+ *  queried with @ref glfwGetCounter.  Counters that do not apply to the
+ *  current platform remain zero.
+ *
+ *  @ingroup init
+ *  @{ */
+/*! @brief Selection conversion requests answered by this process.
+ */
+#define GLFW_SELECTION_REQUESTS     0x00080001
+/*! @brief Incremental selection transfers started by this process.
+ */
+#define GLFW_SELECTION_TRANSFERS    0x00080002
+/*! @brief Chunks of selection data sent by incremental transfers.
+ */
+#define GLFW_SELECTION_CHUNKS       0x00080003
+/*! @brief Bytes of selection data sent to other clients.
+ */
+#define GLFW_SELECTION_BYTES        0x00080004
+/*! @brief Time spent serving selection data, in timer units.
+ */
+#define GLFW_SELECTION_TIME         0x00080005
+/*! @brief Window system events processed.
+ */
+#define GLFW_EVENTS_PROCESSED       0x00080006
+/*! @brief Window system events merged into a later event and not processed.
+ */
+#define GLFW_EVENTS_COALESCED       0x00080007
+/*! @brief Window system events left queued because an event budget ran out.
+ */
+#define GLFW_EVENTS_DEFERRED        0x00080008
+/*! @brief Calls to glfwMakeContextCurrent that changed the current context.
+ */
+#define GLFW_CONTEXT_SWITCHES       0x00080009
+/*! @brief Calls to glfwMakeContextCurrent with the context already current.
+ */
+#define GLFW_CONTEXT_SWITCHES_ELIDED 0x0008000A
+/*! @brief Time spent changing the current context, in timer units.
+ */
+#define GLFW_CONTEXT_SWITCH_TIME    0x0008000B
+/*! @brief Buffer swaps that waited for the oldest asynchronous readback.
+ */
+#define GLFW_READBACK_STALLS        0x0008000C
+/*! @} */
+
+/*! @defgroup wait_fd_events File descriptor readiness flags
+ *  @brief Readiness flags for file descriptors in the event wait set.
+ *
+ *  These flags select and report the readiness of file descriptors added to
+ *  the [event wait set](@ref wait_fds) with @ref glfwAddWaitFd.
+ *
+ *  @ingroup window
+ *  @{ */
+/*! @brief The file descriptor can be read without blocking.
+ */
+#define GLFW_WAIT_READABLE          0x0001
+/*! @brief The file descriptor can be written without blocking.
+ */
+#define GLFW_WAIT_WRITABLE          0x0002
+/*! @brief The file descriptor has an error, was hung up or is invalid.
+ *
+ *  This flag is only reported and is always waited for.
+ */
+#define GLFW_WAIT_ERROR             0x0004
+/*! @} */
+
 #define GLFW_DONT_CARE              -1
 
 
@@ -1970,6 +2084,74 @@ typedef void (* GLFWcharmodsfun)(GLFWwindow* window, unsigned int codepoint, int
  */
 typedef void (* GLFWdropfun)(GLFWwindow* window, int path_count, const char* paths[]);
 
+/*! @brief The function pointer type for clipboard string callbacks.
+ *
+ *  This is the function pointer type for clipboard string callbacks.
+ *  A clipboard string callback function has the following signature:
+ *  @code
+ *  void function_name(const char* string)
+ *  @endcode
+ *
+ *  @param[in] string The contents of the clipboard as a UTF-8 encoded string,
+ *  or `NULL` if the clipboard is empty or could not be converted.
+ *
+ *  @pointer_lifetime The string is valid until the callback function
+ *  returns.
+ *
+ *  @sa @ref clipboard
+ *  @sa @ref glfwRequestClipboardString
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWclipboardfun)(const char* string);
+
+/*! @brief The function pointer type for clipboard data callbacks.
+ *
+ *  This is the function pointer type for clipboard data callbacks.  A clipboard
+ *  data callback function has the following signature:
+ *  @code
+ *  void function_name(const void* data, size_t size, void* user)
+ *  @endcode
+ *
+ *  @param[in] data The next chunk of the clipboard data.
+ *  @param[in] size The size, in bytes, of the chunk.
+ *  @param[in] user The user pointer passed to @ref glfwReadClipboardData.
+ *
+ *  @pointer_lifetime The chunk is valid until the callback function returns.
+ *
+ *  @sa @ref clipboard_data
+ *  @sa @ref glfwReadClipboardData
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWclipboarddatafun)(const void* data, size_t size, void* user);
+
+/*! @brief The function pointer type for wait file descriptor callbacks.
+ *
+ *  This is the function pointer type for wait file descriptor callbacks.
+ *  A wait file descriptor callback function has the following signature:
+ *  @code
+ *  void function_name(int fd, int events, void* user)
+ *  @endcode
+ *
+ *  @param[in] fd The file descriptor that is ready.
+ *  @param[in] events One or more [readiness flags](@ref wait_fd_events)
+ *  describing how the file descriptor is ready.
+ *  @param[in] user The user pointer passed to @ref glfwAddWaitFd.
+ *
+ *  @sa @ref wait_fds
+ *  @sa @ref glfwAddWaitFd
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+typedef void (* GLFWwaitfdfun)(int fd, int events, void* user);
+
 /*! @brief The function pointer type for monitor configuration callbacks.
  *
  *  This is the function pointer type for monitor configuration callbacks.
@@ -2101,6 +2283,33 @@ typedef struct GLFWimage
     unsigned char* pixels;
 } GLFWimage;
 
+/*! @brief The function pointer type for readback callbacks.
+ *
+ *  This is the function pointer type for readback callbacks.  A readback
+ *  callback function has the following signature:
+ *  @code
+ *  void function_name(GLFWwindow* window, const GLFWimage* image, uint64_t frame)
+ *  @endcode
+ *
+ *  @param[in] window The window whose frame was read back.
+ *  @param[in] image The contents of the framebuffer as 8-bit RGBA pixels.
+ *  Unlike other images, the rows are arranged bottom-to-top, as returned by
+ *  OpenGL.
+ *  @param[in] frame The number of the frame, counting from zero at the first
+ *  buffer swap with a readback callback set.
+ *
+ *  @pointer_lifetime The image and its pixel data are valid until the callback
+ *  function returns.
+ *
+ *  @sa @ref context_readback
+ *  @sa @ref glfwSetReadbackCallback
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup context
+ */
+typedef void (* GLFWreadbackfun)(GLFWwindow* window, const GLFWimage* image, uint64_t frame);
+
 /*! @brief Gamepad input state
  *
  *  This describes the input state of a gamepad.
@@ -2124,6 +2333,85 @@ typedef struct GLFWgamepadstate
     float axes[6];
 } GLFWgamepadstate;
 
+/*! @brief Input event record.
+ *
+ *  This describes a single input event stored in the event queue of a window.
+ *  Which members are used depends on the [event type](@ref event_types).
+ *
+ *  - `GLFW_EVENT_KEY` uses `code` for the [key](@ref keys), `scancode`,
+ *    `action` and `mods`.
+ *  - `GLFW_EVENT_CHAR` uses `code` for the Unicode code point and `mods`.
+ *  - `GLFW_EVENT_MOUSE_BUTTON` uses `code` for the [button](@ref buttons),
+ *    `action` and `mods`.
+ *  - `GLFW_EVENT_CURSOR_POS` uses `x` and `y` for the cursor position.
+ *  - `GLFW_EVENT_CURSOR_ENTER` uses `code`, which is `GLFW_TRUE` if the cursor
+ *    entered the content area and `GLFW_FALSE` if it left.
+ *  - `GLFW_EVENT_SCROLL` uses `x` and `y` for the scroll offsets.
+ *
+ *  Unused members are set to zero.
+ *
+ *  @sa @ref event_queue
+ *  @sa @ref glfwGetEvents
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWevent
+{
+    /*! The [type](@ref event_types) of the event.
+     */
+    int type;
+    /*! The key, character, mouse button or enter state of the event.
+     */
+    int code;
+    /*! The platform-specific scancode of a key event.
+     */
+    int scancode;
+    /*! The action of a key or mouse button event.
+     */
+    int action;
+    /*! The [modifier bits](@ref mods) of the event.
+     */
+    int mods;
+    /*! The cursor position or horizontal scroll offset of the event.
+     */
+    double x;
+    /*! The cursor position or vertical scroll offset of the event.
+     */
+    double y;
+    /*! The time of the event, in the time base of @ref glfwGetTimerValue.
+     *  This is the platform timestamp of the event where available, as
+     *  returned by @ref glfwGetEventTime.
+     */
+    uint64_t time;
+} GLFWevent;
+
+/*! @brief Clipboard item.
+ *
+ *  This describes one format of the clipboard contents, as a MIME type and the
+ *  data in that format.
+ *
+ *  @sa @ref clipboard_data
+ *  @sa @ref glfwSetClipboardData
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWclipboarditem
+{
+    /*! The MIME type of the data, for example `image/png`.
+     */
+    const char* type;
+    /*! The data in the format of the MIME type.
+     */
+    const void* data;
+    /*! The size, in bytes, of the data.
+     */
+    size_t size;
+} GLFWclipboarditem;
+
 /*! @brief Custom heap memory allocator.
  *
  *  This describes a custom heap memory allocator for GLFW.  To set an allocator, pass it
@@ -2549,6 +2837,29 @@ GLFWAPI int glfwGetPlatform(void);
  */
 GLFWAPI int glfwPlatformSupported(int platform);
 
+/*! @brief Returns the value of the specified instrumentation counter.
+ *
+ *  This function returns the current value of the specified
+ *  [instrumentation counter](@ref instrumentation).  Counters start at zero
+ *  when the library is initialized and only ever increase.
+ *
+ *  @param[in] counter The [counter](@ref counters) to query.
+ *  @return The value of the counter, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_ENUM.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref instrumentation
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup init
+ */
+GLFWAPI uint64_t glfwGetCounter(int counter);
+
 /*! @brief Returns the currently connected monitors.
  *
  *  This function returns an array of handles for all currently connected
@@ -4629,6 +4940,133 @@ GLFWAPI void glfwWaitEvents(void);
  */
 GLFWAPI void glfwWaitEventsTimeout(double timeout);
 
+/*! @brief Waits until events are queued or a deadline is reached and processes
+ *  them.
+ *
+ *  This function puts the calling thread to sleep until at least one event is
+ *  available in the event queue, or until the timer reaches the specified
+ *  value.  If one or more events are available, it behaves exactly like @ref
+ *  glfwPollEvents, i.e. the events in the queue are processed and the function
+ *  then returns immediately.  Processing events will cause the window and input
+ *  callbacks associated with those events to be called.
+ *
+ *  Unlike @ref glfwWaitEventsTimeout, the deadline is an absolute value of the
+ *  raw timer returned by @ref glfwGetTimerValue.  Waits that are interrupted
+ *  and resumed therefore cannot drift, and a frame loop can wait until the
+ *  start of its next frame without accumulating error.  If the deadline has
+ *  already passed, this function behaves like @ref glfwPollEvents.
+ *
+ *  Since not all events are associated with callbacks, this function may return
+ *  without a callback having been called even if you are monitoring all
+ *  callbacks.
+ *
+ *  On some platforms, a window move, resize or menu operation will cause event
+ *  processing to block.  This is due to how event processing is designed on
+ *  those platforms.  You can use the
+ *  [window refresh callback](@ref window_refresh) to redraw the contents of
+ *  your window when necessary during such operations.
+ *
+ *  Event processing is not required for joystick input to work.
+ *
+ *  @param[in] deadline The timer value, in units of @ref
+ *  glfwGetTimerFrequency, at which to stop waiting.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @x11 @wayland On Linux the wait ends on an absolute timer, which
+ *  is not delayed by the timer slack applied to other waits.  Elsewhere it has
+ *  nanosecond resolution where `ppoll` is available and millisecond resolution
+ *  otherwise.
+ *
+ *  @remark @win32 The wait has millisecond resolution.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref events
+ *  @sa @ref glfwWaitEventsTimeout
+ *  @sa @ref glfwGetTimerValue
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwWaitEventsUntil(uint64_t deadline);
+
+/*! @brief Adds a file descriptor to the event wait set.
+ *
+ *  This function adds the specified file descriptor to the set of file
+ *  descriptors waited on by @ref glfwWaitEvents, @ref glfwWaitEventsTimeout and
+ *  @ref glfwWaitEventsUntil, together with those of the window system.  When
+ *  the file descriptor becomes ready, the wait ends and the specified callback
+ *  is called.  @ref glfwPollEvents also calls the callback for file
+ *  descriptors that are already ready.
+ *
+ *  Readiness is level-triggered, so the callback is called during each event
+ *  processing call for as long as the file descriptor remains ready.
+ *
+ *  If the file descriptor is already in the wait set, its readiness flags,
+ *  callback and user pointer are replaced.
+ *
+ *  Errors and hang-ups are reported with @ref GLFW_WAIT_ERROR for as long as
+ *  they persist, so remove the file descriptor with @ref glfwRemoveWaitFd when
+ *  it reports an error, and before closing it.
+ *
+ *  @param[in] fd The file descriptor to add.
+ *  @param[in] events One or both of @ref GLFW_WAIT_READABLE and @ref
+ *  GLFW_WAIT_WRITABLE.
+ *  @param[in] callback The function to call when the file descriptor is ready.
+ *  @param[in] user A user pointer passed to the callback.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @remark @win32 @macos Event processing does not wait on file descriptors
+ *  on this platform and this function emits @ref GLFW_FEATURE_UNAVAILABLE.
+ *  The same applies to the AmigaOS 4 and null platforms.
+ *
+ *  @remark The callback is called during event processing and must not call
+ *  any of the event processing functions.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref wait_fds
+ *  @sa @ref glfwRemoveWaitFd
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwAddWaitFd(int fd, int events, GLFWwaitfdfun callback, void* user);
+
+/*! @brief Removes a file descriptor from the event wait set.
+ *
+ *  This function removes the specified file descriptor from the set of file
+ *  descriptors waited on during event processing.  If the file descriptor is
+ *  not in the wait set, this function does nothing.
+ *
+ *  This function may be called from the callback of any file descriptor in the
+ *  wait set, including the one being removed.
+ *
+ *  @param[in] fd The file descriptor to remove.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref wait_fds
+ *  @sa @ref glfwAddWaitFd
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwRemoveWaitFd(int fd);
+
 /*! @brief Posts an empty event to the event queue.
  *
  *  This function posts an empty event from the current thread to the event
@@ -4653,13 +5091,17 @@ GLFWAPI void glfwPostEmptyEvent(void);
  *
  *  This function returns the value of an input option for the specified window.
  *  The mode must be one of @ref GLFW_CURSOR, @ref GLFW_STICKY_KEYS,
- *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS or
- *  @ref GLFW_RAW_MOUSE_MOTION.
+ *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS,
+ *  @ref GLFW_RAW_MOUSE_MOTION, @ref GLFW_UNLIMITED_MOUSE_BUTTONS,
+ *  @ref GLFW_EVENT_QUEUE, @ref GLFW_COALESCE_CURSOR_MOTION or
+ *  @ref GLFW_CURSOR_MOTION_HISTORY.
  *
  *  @param[in] window The window to query.
  *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
- *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS` or
- *  `GLFW_RAW_MOUSE_MOTION`.
+ *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS`,
+ *  `GLFW_RAW_MOUSE_MOTION`, `GLFW_UNLIMITED_MOUSE_BUTTONS`,
+ *  `GLFW_EVENT_QUEUE`, `GLFW_COALESCE_CURSOR_MOTION` or
+ *  `GLFW_CURSOR_MOTION_HISTORY`.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
  *  GLFW_INVALID_ENUM.
@@ -4678,8 +5120,10 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
  *
  *  This function sets an input mode option for the specified window.  The mode
  *  must be one of @ref GLFW_CURSOR, @ref GLFW_STICKY_KEYS,
- *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS
- *  @ref GLFW_RAW_MOUSE_MOTION, or @ref GLFW_UNLIMITED_MOUSE_BUTTONS.
+ *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS,
+ *  @ref GLFW_RAW_MOUSE_MOTION, @ref GLFW_UNLIMITED_MOUSE_BUTTONS,
+ *  @ref GLFW_EVENT_QUEUE, @ref GLFW_COALESCE_CURSOR_MOTION or
+ *  @ref GLFW_CURSOR_MOTION_HISTORY.
  *
  *  If the mode is `GLFW_CURSOR`, the value must be one of the following cursor
  *  modes:
@@ -4724,10 +5168,33 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
  *  callback, or `GLFW_FALSE` to limit the mouse buttons sent to the callback
  *  to the mouse button token values up to `GLFW_MOUSE_BUTTON_LAST`.
  *
+ *  If the mode is `GLFW_EVENT_QUEUE`, the value must be either `GLFW_TRUE` to
+ *  store key, character, mouse button, cursor position, cursor enter and
+ *  scroll events in a per-window queue instead of passing them to the
+ *  callbacks, or `GLFW_FALSE` to deliver them to the callbacks again.
+ *  Disabling the queue discards any events still in it.  Queued events are
+ *  retrieved with @ref glfwGetEvents.
+ *
+ *  If the mode is `GLFW_COALESCE_CURSOR_MOTION`, the value must be either
+ *  `GLFW_TRUE` to merge all cursor motion received during one call to @ref
+ *  glfwPollEvents, @ref glfwWaitEvents or @ref glfwWaitEventsTimeout into
+ *  a single cursor position event for the final position, or `GLFW_FALSE` to
+ *  report every cursor position.  Motion merged before a mouse button, cursor
+ *  enter or cursor leave event, or before the mode is disabled, is reported at
+ *  that point.  The accumulated motion is retrieved with @ref
+ *  glfwGetCursorMotion.
+ *
+ *  If the mode is `GLFW_CURSOR_MOTION_HISTORY`, the value must be either
+ *  `GLFW_TRUE` to record every cursor position merged by
+ *  `GLFW_COALESCE_CURSOR_MOTION`, or `GLFW_FALSE` to discard the record.  The
+ *  recorded positions are retrieved with @ref glfwGetCursorHistory.
+ *
  *  @param[in] window The window whose input mode to set.
  *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
- *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS` or
- *  `GLFW_RAW_MOUSE_MOTION`.
+ *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS`,
+ *  `GLFW_RAW_MOUSE_MOTION`, `GLFW_UNLIMITED_MOUSE_BUTTONS`,
+ *  `GLFW_EVENT_QUEUE`, `GLFW_COALESCE_CURSOR_MOTION` or
+ *  `GLFW_CURSOR_MOTION_HISTORY`.
  *  @param[in] value The new value of the specified input mode.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
@@ -4977,6 +5444,75 @@ GLFWAPI int glfwGetMouseButton(GLFWwindow* window, int button);
  */
 GLFWAPI void glfwGetCursorPos(GLFWwindow* window, double* xpos, double* ypos);
 
+/*! @brief Retrieves the cursor motion of the last event processing pass.
+ *
+ *  This function returns the sum of the cursor motion, in screen coordinates,
+ *  merged into a single cursor position event by the @ref
+ *  GLFW_COALESCE_CURSOR_MOTION input mode during the last call to @ref
+ *  glfwPollEvents, @ref glfwWaitEvents or @ref glfwWaitEventsTimeout.  If the
+ *  cursor did not move or the input mode is disabled, the motion is zero.
+ *
+ *  If the cursor is disabled (with `GLFW_CURSOR_DISABLED`) and @ref
+ *  GLFW_RAW_MOUSE_MOTION is enabled, this is the sum of the raw motion.  Moving
+ *  the cursor with @ref glfwSetCursorPos does not add to the motion.
+ *
+ *  Any or all of the motion arguments may be `NULL`.  If an error occurs, all
+ *  non-`NULL` motion arguments will be set to zero.
+ *
+ *  @param[in] window The desired window.
+ *  @param[out] xdelta Where to store the horizontal motion, or `NULL`.
+ *  @param[out] ydelta Where to store the vertical motion, or `NULL`.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref cursor_coalesce
+ *  @sa @ref glfwGetCursorHistory
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwGetCursorMotion(GLFWwindow* window, double* xdelta, double* ydelta);
+
+/*! @brief Returns the cursor positions of the last event processing pass.
+ *
+ *  This function returns the cursor positions, oldest first, merged into
+ *  a single cursor position event by the @ref GLFW_COALESCE_CURSOR_MOTION input
+ *  mode during the last call to @ref glfwPollEvents, @ref glfwWaitEvents or
+ *  @ref glfwWaitEventsTimeout.  Positions are only recorded while the @ref
+ *  GLFW_CURSOR_MOTION_HISTORY input mode is enabled for the window.
+ *
+ *  Each position is a @ref GLFWevent record of type @ref GLFW_EVENT_CURSOR_POS
+ *  with the time the position was received.  The history holds a fixed number
+ *  of positions.  If more arrive during a single pass, the last record is
+ *  replaced so that the history always ends with the final position.
+ *
+ *  @param[in] window The desired window.
+ *  @param[out] count Where to store the number of positions in the returned
+ *  array.  This is set to zero if the history is disabled or an
+ *  [error](@ref error_handling) occurred.
+ *  @return An array of cursor positions, or `NULL` if the history is disabled
+ *  or an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @pointer_lifetime The returned array is allocated and freed by GLFW.  You
+ *  should not free it yourself.  It is valid until the next event processing
+ *  pass, until the history is disabled or until the window is destroyed.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref cursor_coalesce
+ *  @sa @ref glfwGetCursorMotion
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI const GLFWevent* glfwGetCursorHistory(GLFWwindow* window, int* count);
+
 /*! @brief Sets the position of the cursor, relative to the content area of the
  *  window.
  *
@@ -5466,6 +6002,38 @@ GLFWAPI GLFWscrollfun glfwSetScrollCallback(GLFWwindow* window, GLFWscrollfun ca
  */
 GLFWAPI GLFWdropfun glfwSetDropCallback(GLFWwindow* window, GLFWdropfun callback);
 
+/*! @brief Retrieves queued input events for the specified window.
+ *
+ *  This function removes up to the specified number of events from the event
+ *  queue of the specified window and copies them, oldest first, into the
+ *  provided array.  Events are only queued while the @ref GLFW_EVENT_QUEUE
+ *  input mode is enabled for the window.
+ *
+ *  The queue holds a fixed number of events.  If it fills up before it is
+ *  drained, the oldest events are discarded to make room for new ones.
+ *  Events are added to the queue during event processing, so this is normally
+ *  called once per frame after @ref glfwPollEvents or similar.
+ *
+ *  @param[in] window The window whose events to retrieve.
+ *  @param[out] events The array to receive the events.
+ *  @param[in] count The size of the array, in elements.
+ *  @return The number of events written to the array, or zero if no events
+ *  are queued or an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref event_queue
+ *  @sa @ref GLFWevent
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwGetEvents(GLFWwindow* window, GLFWevent* events, int count);
+
 /*! @brief Returns whether the specified joystick is present.
  *
  *  This function returns whether the specified joystick is present.
@@ -5621,6 +6189,41 @@ GLFWAPI const unsigned char* glfwGetJoystickButtons(int jid, int* count);
  */
 GLFWAPI const unsigned char* glfwGetJoystickHats(int jid, int* count);
 
+/*! @brief Returns the time of the most recent state change of the specified
+ *  joystick.
+ *
+ *  This function returns the time at which the axes, buttons or hats of the
+ *  specified joystick last changed state, in the time base of @ref
+ *  glfwGetTimerValue.  Where the platform provides device timestamps, this is
+ *  the time the device reported the change rather than the time GLFW
+ *  processed it.
+ *
+ *  If the specified joystick is not present or has not changed state since it
+ *  was connected, this function will return zero but will not generate an
+ *  error.
+ *
+ *  @param[in] jid The [joystick](@ref joysticks) to query.
+ *  @return The time of the most recent state change, or zero if the joystick
+ *  is not present, has not changed state or an [error](@ref error_handling)
+ *  occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_ENUM and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @linux Device timestamps are used if the kernel supports reporting
+ *  them from the monotonic clock.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick
+ *  @sa @ref glfwGetEventTime
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI uint64_t glfwGetJoystickEventTime(int jid);
+
 /*! @brief Returns the name of the specified joystick.
  *
  *  This function returns the name, encoded as UTF-8, of the specified joystick.
@@ -5911,6 +6514,39 @@ GLFWAPI const char* glfwGetGamepadName(int jid);
  */
 GLFWAPI int glfwGetGamepadState(int jid, GLFWgamepadstate* state);
 
+/*! @brief Retrieves the state of all joysticks remapped as gamepads.
+ *
+ *  This function retrieves the state of the first `count` joysticks remapped to
+ *  an Xbox-like gamepad, as if by calling @ref glfwGetGamepadState for each of
+ *  them.  Each connected joystick is polled once and the state of the joystick
+ *  with ID `jid` is written to `states[jid]`.
+ *
+ *  The states of joysticks that are not present or do not have a gamepad
+ *  mapping are cleared and the corresponding bits of the returned mask are not
+ *  set.  No error is generated for these joysticks.
+ *
+ *  @param[out] states An array of gamepad input states, indexed by
+ *  [joystick ID](@ref joysticks).
+ *  @param[in] count The number of elements in the `states` array.  This must
+ *  be at most `GLFW_JOYSTICK_LAST + 1`.
+ *  @return A bit mask where bit `jid` is set if `states[jid]` holds the state
+ *  of a connected gamepad, or zero if no gamepad is connected or an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref gamepad
+ *  @sa @ref glfwGetGamepadState
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwGetGamepadStates(GLFWgamepadstate* states, int count);
+
 /*! @brief Sets the clipboard to the specified string.
  *
  *  This function sets the system clipboard to the specified, UTF-8 encoded
@@ -5976,6 +6612,173 @@ GLFWAPI void glfwSetClipboardString(GLFWwindow* window, const char* string);
  */
 GLFWAPI const char* glfwGetClipboardString(GLFWwindow* window);
 
+/*! @brief Requests the contents of the clipboard as a string.
+ *
+ *  This function requests the contents of the system clipboard as a UTF-8
+ *  encoded string and returns without waiting for it.  The specified callback
+ *  is called with the string once it has been received, or with `NULL` if the
+ *  clipboard is empty or its contents cannot be converted.
+ *
+ *  Only one request can be pending at a time.  Requesting again before the
+ *  callback has been called replaces the callback of the pending request.
+ *  Passing `NULL` cancels the pending request, if any.
+ *
+ *  @param[in] callback The function to call with the clipboard string, or
+ *  `NULL` to cancel the pending request.
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(const char* string)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWclipboardfun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @x11 The clipboard contents are received during event processing,
+ *  so the callback is called from @ref glfwPollEvents or similar.  Large
+ *  clipboards are received incrementally without blocking.  If the clipboard
+ *  owner stops responding for two seconds, a @ref GLFW_PLATFORM_ERROR is
+ *  emitted, the callback is called with `NULL` and the request ends.  If the
+ *  clipboard was set by this process, the callback is called before this
+ *  function returns.
+ *
+ *  @remark On other platforms the clipboard is read synchronously and the
+ *  callback is called before this function returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref clipboard
+ *  @sa @ref glfwGetClipboardString
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwRequestClipboardString(GLFWclipboardfun callback);
+
+/*! @brief Sets the clipboard to the specified data in one or more formats.
+ *
+ *  This function sets the system clipboard to the specified items, each of
+ *  which holds the data in one format identified by a MIME type.  Other
+ *  applications can then retrieve the contents in any of those formats.
+ *
+ *  Each item is copied once and served from that copy until the clipboard is
+ *  changed again.  This replaces any string set with @ref
+ *  glfwSetClipboardString.  An item of type `text/plain;charset=utf-8` is also
+ *  returned by @ref glfwGetClipboardString and @ref glfwRequestClipboardString.
+ *
+ *  @param[in] items The items to place on the clipboard.
+ *  @param[in] count The number of items in the array.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_FEATURE_UNIMPLEMENTED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @x11 The MIME types are used as selection target names.  An item of
+ *  type `text/plain;charset=utf-8` is also offered as `UTF8_STRING`.
+ *
+ *  @remark @win32 @macos This function is not yet implemented and emits @ref
+ *  GLFW_FEATURE_UNIMPLEMENTED.  The clipboard is left unchanged.
+ *
+ *  @pointer_lifetime The specified items are copied before this function
+ *  returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref clipboard_data
+ *  @sa @ref glfwGetClipboardTypes
+ *  @sa @ref glfwReadClipboardData
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwSetClipboardData(const GLFWclipboarditem* items, int count);
+
+/*! @brief Returns the formats the clipboard contents are available in.
+ *
+ *  This function returns the MIME types of the formats the system clipboard
+ *  contents are currently available in.
+ *
+ *  @param[out] count Where to store the number of types in the returned
+ *  array.  This is set to zero if the clipboard is empty or an
+ *  [error](@ref error_handling) occurred.
+ *  @return An array of MIME types, or `NULL` if the clipboard is empty or an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_FEATURE_UNIMPLEMENTED and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @x11 The types are the target names offered by the selection
+ *  owner, which may include non-MIME targets like `UTF8_STRING` and
+ *  `TARGETS`.
+ *
+ *  @remark @win32 @macos This function is not yet implemented and emits @ref
+ *  GLFW_FEATURE_UNIMPLEMENTED.
+ *
+ *  @pointer_lifetime The returned array and strings are allocated and freed by
+ *  GLFW.  You should not free them yourself.  They are valid until the next
+ *  call to this function or the clipboard is changed by this process, or until
+ *  the library is terminated.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref clipboard_data
+ *  @sa @ref glfwReadClipboardData
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI const char** glfwGetClipboardTypes(int* count);
+
+/*! @brief Reads the clipboard contents in the specified format.
+ *
+ *  This function reads the contents of the system clipboard in the format of
+ *  the specified MIME type and passes them to the specified callback in one or
+ *  more chunks, in order.  The data is passed on as it arrives and is not
+ *  collected into a single buffer, so the callback can copy it to a buffer of
+ *  your own or write it to a file descriptor.
+ *
+ *  @param[in] type The MIME type of the format to read.
+ *  @param[in] callback The function to call with each chunk of the data.
+ *  @param[in] user An arbitrary pointer passed to the callback.
+ *  @return `GLFW_TRUE` if all of the data was read, or `GLFW_FALSE` if the
+ *  format is unavailable or an [error](@ref error_handling) occurred.  Some
+ *  of the data may already have been passed to the callback if the transfer
+ *  failed part way through.
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(const void* data, size_t size, void* user)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWclipboarddatafun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_FORMAT_UNAVAILABLE, @ref GLFW_FEATURE_UNIMPLEMENTED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark This function blocks until the transfer is complete.  The callback
+ *  is called before this function returns.
+ *
+ *  @remark @win32 @macos This function is not yet implemented and emits @ref
+ *  GLFW_FEATURE_UNIMPLEMENTED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref clipboard_data
+ *  @sa @ref glfwGetClipboardTypes
+ *  @sa @ref glfwSetClipboardData
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwReadClipboardData(const char* type, GLFWclipboarddatafun callback, void* user);
+
 /*! @brief Returns the GLFW time.
  *
  *  This function returns the current GLFW time, in seconds.  Unless the time
@@ -6078,6 +6881,43 @@ GLFWAPI uint64_t glfwGetTimerValue(void);
  */
 GLFWAPI uint64_t glfwGetTimerFrequency(void);
 
+/*! @brief Returns the time of the input event being processed.
+ *
+ *  This function returns the time at which the input event currently being
+ *  reported to a callback was generated, in the time base of @ref
+ *  glfwGetTimerValue.  Where the window system provides event timestamps, this
+ *  is the time of the original device or server event, so the delay before
+ *  the event was processed can be measured.
+ *
+ *  The same time is stored in the `time` member of the @ref GLFWevent records
+ *  of the [event queue](@ref event_queue).
+ *
+ *  If this function is called outside of an input callback or the window system
+ *  does not provide a timestamp for the event, it returns the current value of
+ *  the timer.
+ *
+ *  @return The time of the input event, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @remark @x11 @wayland Window system timestamps have millisecond resolution
+ *  and are mapped to the timer by the smallest observed processing delay.
+ *
+ *  @remark @win32 @macos Event timestamps are not yet provided on these
+ *  platforms.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref input_time
+ *  @sa @ref glfwGetTimerValue
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI uint64_t glfwGetEventTime(void);
+
 /*! @brief Makes the context of the specified window current for the calling
  *  thread.
  *
@@ -6092,6 +6932,16 @@ GLFWAPI uint64_t glfwGetTimerFrequency(void);
  *  When moving a context between threads, you must detach it (make it
  *  non-current) on the old thread before making it current on the new one.
  *
+ *  If the context is already current on the calling thread, or if `NULL` is
+ *  passed and no context is current, this function returns without making the
+ *  context current again.  This is only done where the context creation API
+ *  reports that the context and its surface are still current, so restoring
+ *  a GLFW context after making a context current without GLFW still works.
+ *  With OSMesa and on AmigaOS 4 the context is always made current again.  The
+ *  @ref GLFW_CONTEXT_SWITCHES and @ref GLFW_CONTEXT_SWITCHES_ELIDED
+ *  [counters](@ref instrumentation) show how many calls changed the current
+ *  context.
+ *
  *  By default, making a context non-current implicitly forces a pipeline flush.
  *  On machines that support `GL_KHR_context_flush_control`, you can control
  *  whether a context performs this flush by setting the
@@ -6158,10 +7008,15 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void);
  *  This function does not apply to Vulkan.  If you are rendering with Vulkan,
  *  see `vkQueuePresentKHR` instead.
  *
+ *  If the window has a [readback callback](@ref glfwSetReadbackCallback), this
+ *  function also starts reading back the frame and passes any frames that have
+ *  finished to the callback.
+ *
  *  @param[in] window The window whose buffers to swap.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
- *  GLFW_NO_WINDOW_CONTEXT and @ref GLFW_PLATFORM_ERROR.
+ *  GLFW_NO_WINDOW_CONTEXT, @ref GLFW_NO_CURRENT_CONTEXT, @ref
+ *  GLFW_VERSION_UNAVAILABLE and @ref GLFW_PLATFORM_ERROR.
  *
  *  @remark __EGL:__ The context of the specified window must be current on the
  *  calling thread.
@@ -6234,10 +7089,10 @@ GLFWAPI void glfwSwapInterval(int interval);
  *  A context must be current on the calling thread.  Calling this function
  *  without a current context will cause a @ref GLFW_NO_CURRENT_CONTEXT error.
  *
- *  As this functions retrieves and searches one or more extension strings each
- *  call, it is recommended that you cache its results if it is going to be used
- *  frequently.  The extension strings will not change during the lifetime of
- *  a context, so there is no danger in doing this.
+ *  The extension strings are retrieved once when the context is created and
+ *  kept in a hash set, so this function is cheap enough to call as often as
+ *  needed.  The extension strings will not change during the lifetime of
+ *  a context.
  *
  *  This function does not apply to Vulkan.  If you are using Vulkan, see @ref
  *  glfwGetRequiredInstanceExtensions, `vkEnumerateInstanceExtensionProperties`
@@ -6297,6 +7152,7 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  *
  *  @sa @ref context_glext
  *  @sa @ref glfwExtensionSupported
+ *  @sa @ref glfwGetProcAddresses
  *
  *  @since Added in version 1.0.
  *
@@ -6304,6 +7160,171 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  */
 GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname);
 
+/*! @brief Returns the addresses of the specified functions for the current
+ *  context.
+ *
+ *  This function returns the addresses of the specified OpenGL or OpenGL ES
+ *  [core or extension functions](@ref context_glext) for the current context,
+ *  like calling @ref glfwGetProcAddress for each of them but in a single call.
+ *  Functions that are not found are set to `NULL`.
+ *
+ *  Resolved addresses are cached and shared between contexts created with the
+ *  same context creation API and client API, so loading the same functions for
+ *  further contexts does not query the driver again.
+ *
+ *  A context must be current on the calling thread.  Calling this function
+ *  without a current context will cause a @ref GLFW_NO_CURRENT_CONTEXT error.
+ *
+ *  This function does not apply to Vulkan.
+ *
+ *  @param[in] procnames The ASCII encoded names of the functions.
+ *  @param[out] procs Where to store the addresses of the functions.
+ *  @param[in] count The number of elements in the `procnames` and `procs`
+ *  arrays.
+ *  @return The number of functions found, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_CURRENT_CONTEXT, @ref GLFW_INVALID_VALUE and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The address of a given function is not guaranteed to be the same
+ *  between contexts.
+ *
+ *  @remark @win32 Native contexts only share cached addresses with the
+ *  contexts they share objects with, as WGL addresses may differ between pixel
+ *  formats.
+ *
+ *  @pointer_lifetime The returned function pointers are valid until the
+ *  context is destroyed or the library is terminated.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref context_glext
+ *  @sa @ref glfwGetProcAddress
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwGetProcAddresses(const char** procnames, GLFWglproc* procs, int count);
+
+/*! @brief Prepares the framebuffer configs for windows with the current hints.
+ *
+ *  This function loads the context creation API selected by the current
+ *  [window hints](@ref window_hints), retrieves its framebuffer configs and
+ *  chooses the one closest to the current framebuffer hints, as @ref
+ *  glfwCreateWindow would.  The configs and the choice are kept until the
+ *  library is terminated, so later windows with the same hints do not query
+ *  them again.  This lets an application move that work to startup.
+ *
+ *  Framebuffer configs are cached for GLX and EGL whether or not this function
+ *  is called.  If the current hints do not request a context, this function
+ *  does nothing.
+ *
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_ENUM, @ref GLFW_INVALID_VALUE, @ref GLFW_API_UNAVAILABLE, @ref
+ *  GLFW_VERSION_UNAVAILABLE, @ref GLFW_FORMAT_UNAVAILABLE, @ref
+ *  GLFW_FEATURE_UNAVAILABLE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @win32 @macos Native contexts do not support this function and
+ *  will emit @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @remark OSMesa contexts do not support this function and will emit @ref
+ *  GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_hints
+ *  @sa @ref glfwCreateWindow
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwPreloadFramebufferConfigs(void);
+
+/*! @brief Sets the readback callback for the specified window.
+ *
+ *  This function sets the readback callback of the specified window, which is
+ *  called with the contents of its framebuffer a few frames after they were
+ *  rendered.
+ *
+ *  While a readback callback is set, @ref glfwSwapBuffers starts an
+ *  asynchronous copy of the framebuffer into a pixel buffer object before
+ *  swapping.  The frame is passed to the callback by a later call to @ref
+ *  glfwSwapBuffers, once the copy has completed, so reading it back does not
+ *  stall rendering.  Frames are always passed in the order they were rendered.
+ *
+ *  The [GLFW_READBACK_BUFFERS](@ref GLFW_READBACK_BUFFERS_hint) window hint
+ *  sets how many frames may be in flight.  If all of them are still being
+ *  copied, @ref glfwSwapBuffers waits for the oldest one and the @ref
+ *  GLFW_READBACK_STALLS [counter](@ref instrumentation) is incremented.
+ *
+ *  The context of the window must be current on the calling thread when
+ *  swapping its buffers while a readback callback is set.  Asynchronous
+ *  readback requires OpenGL 3.2, OpenGL 3.0 with `GL_ARB_sync` or OpenGL ES
+ *  3.0.
+ *
+ *  To receive the frames still in flight, for example before removing the
+ *  callback or destroying the window, call @ref glfwFinishReadback.
+ *
+ *  @param[in] window The window whose callback to set.
+ *  @param[in] callback The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(GLFWwindow* window, const GLFWimage* image, uint64_t frame)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWreadbackfun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_NO_WINDOW_CONTEXT.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref context_readback
+ *  @sa @ref glfwFinishReadback
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup context
+ */
+GLFWAPI GLFWreadbackfun glfwSetReadbackCallback(GLFWwindow* window, GLFWreadbackfun callback);
+
+/*! @brief Waits for the frames being read back from the specified window.
+ *
+ *  This function waits until every frame being read back from the specified
+ *  window has been copied and passes them to its
+ *  [readback callback](@ref glfwSetReadbackCallback), in the order they were
+ *  rendered.
+ *
+ *  The context of the window must be current on the calling thread.
+ *
+ *  @param[in] window The window whose frames to wait for.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_WINDOW_CONTEXT, @ref GLFW_NO_CURRENT_CONTEXT and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref context_readback
+ *  @sa @ref glfwSetReadbackCallback
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwFinishReadback(GLFWwindow* window);
+
 /*! @brief Returns whether the Vulkan loader and an ICD have been found.
  *
  *  This function returns whether the Vulkan loader and any minimally functional
@@ -509,6 +509,10 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeCocoa,
         .setClipboardString = _glfwSetClipboardStringCocoa,
         .getClipboardString = _glfwGetClipboardStringCocoa,
+        .requestClipboardString = _glfwRequestClipboardStringCocoa,
+        .setClipboardData = _glfwSetClipboardDataCocoa,
+        .getClipboardTypes = _glfwGetClipboardTypesCocoa,
+        .readClipboardData = _glfwReadClipboardDataCocoa,
         .initJoysticks = _glfwInitJoysticksCocoa,
         .terminateJoysticks = _glfwTerminateJoysticksCocoa,
         .pollJoystick = _glfwPollJoystickCocoa,
@@ -558,6 +562,7 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         .pollEvents = _glfwPollEventsCocoa,
         .waitEvents = _glfwWaitEventsCocoa,
         .waitEventsTimeout = _glfwWaitEventsTimeoutCocoa,
+        .waitEventsUntil = _glfwWaitEventsUntilCocoa,
         .postEmptyEvent = _glfwPostEmptyEventCocoa,
         .getEGLPlatform = _glfwGetEGLPlatformCocoa,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayCocoa,
@@ -254,6 +254,7 @@ GLFWbool _glfwRawMouseMotionSupportedCocoa(void);
 void _glfwPollEventsCocoa(void);
 void _glfwWaitEventsCocoa(void);
 void _glfwWaitEventsTimeoutCocoa(double timeout);
+void _glfwWaitEventsUntilCocoa(uint64_t deadline);
 void _glfwPostEmptyEventCocoa(void);
 
 void _glfwGetCursorPosCocoa(_GLFWwindow* window, double* xpos, double* ypos);
@@ -267,6 +268,10 @@ void _glfwDestroyCursorCocoa(_GLFWcursor* cursor);
 void _glfwSetCursorCocoa(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringCocoa(const char* string);
 const char* _glfwGetClipboardStringCocoa(void);
+void _glfwRequestClipboardStringCocoa(void);
+GLFWbool _glfwSetClipboardDataCocoa(void);
+const char** _glfwGetClipboardTypesCocoa(int* count);
+GLFWbool _glfwReadClipboardDataCocoa(const char* type, GLFWclipboarddatafun callback, void* user);
 
 EGLenum _glfwGetEGLPlatformCocoa(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayCocoa(void);
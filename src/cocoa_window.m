@@ -1568,6 +1568,11 @@ void _glfwWaitEventsTimeoutCocoa(double timeout)
     } // autoreleasepool
 }
 
+void _glfwWaitEventsUntilCocoa(uint64_t deadline)
+{
+    _glfwWaitEventsTimeoutCocoa(_glfwGetTimeoutUntil(deadline));
+}
+
 void _glfwPostEmptyEventCocoa(void)
 {
     @autoreleasepool {
@@ -1881,6 +1886,34 @@ const char* _glfwGetClipboardStringCocoa(void)
     } // autoreleasepool
 }
 
+void _glfwRequestClipboardStringCocoa(void)
+{
+    _glfwInputClipboardString(_glfwGetClipboardStringCocoa());
+}
+
+GLFWbool _glfwSetClipboardDataCocoa(void)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "Cocoa: Clipboard data not yet implemented");
+    return GLFW_FALSE;
+}
+
+const char** _glfwGetClipboardTypesCocoa(int* count)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "Cocoa: Clipboard data not yet implemented");
+    return NULL;
+}
+
+GLFWbool _glfwReadClipboardDataCocoa(const char* type,
+                                     GLFWclipboarddatafun callback,
+                                     void* user)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "Cocoa: Clipboard data not yet implemented");
+    return GLFW_FALSE;
+}
+
 EGLenum _glfwGetEGLPlatformCocoa(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
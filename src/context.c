@@ -34,6 +34,567 @@
 #include <stdio.h>
 
 
+// Returns the FNV-1a hash of an extension or entry point name
+//
+static uint32_t hashName(const char* name)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*name)
+    {
+        hash ^= (unsigned char) *name++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Returns the extension index slot for the specified name
+// The slot is either empty or holds the offset plus one of that name
+//
+static int* findExtensionSlot(const _GLFWcontext* context, const char* name)
+{
+    const int mask = context->extensionIndexSize - 1;
+    int i = (int) (hashName(name) & (uint32_t) mask);
+
+    for (;;)
+    {
+        int* slot = context->extensionIndex + i;
+        if (*slot == 0 || strcmp(context->extensionNames + *slot - 1, name) == 0)
+            return slot;
+
+        i = (i + 1) & mask;
+    }
+}
+
+// Copies the names in a space separated extension string as null terminated
+// strings and returns the end of the copied names
+//
+static char* copyExtensionNames(char* target, const char* extensions)
+{
+    while (*extensions)
+    {
+        if (*extensions == ' ')
+        {
+            extensions++;
+            continue;
+        }
+
+        while (*extensions && *extensions != ' ')
+            *target++ = *extensions++;
+
+        *target++ = '\0';
+    }
+
+    return target;
+}
+
+// Returns whether the extension set of the context contains the specified name
+//
+static GLFWbool hasExtension(const _GLFWcontext* context, const char* name)
+{
+    if (!context->extensionIndex)
+        return GLFW_FALSE;
+
+    return *findExtensionSlot(context, name) != 0;
+}
+
+// Builds the set of client and platform extensions of the current context
+// The set is left empty if the client extensions cannot be retrieved, and
+// glfwExtensionSupported then reports that when queried
+//
+static GLFWbool buildExtensionSet(_GLFWwindow* window)
+{
+    _GLFWcontext* context = &window->context;
+    const char* extensions = NULL;
+    const char* platform = context->getExtensionString();
+    GLint i, count = 0;
+    size_t size = 1;
+
+    if (context->major >= 3)
+    {
+        // OpenGL 3.0+ lists the extensions one at a time
+        context->GetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        for (i = 0;  i < count;  i++)
+        {
+            const char* name = (const char*) context->GetStringi(GL_EXTENSIONS, i);
+            if (!name)
+                return GLFW_TRUE;
+
+            size += strlen(name) + 1;
+        }
+    }
+    else
+    {
+        extensions = (const char*) context->GetString(GL_EXTENSIONS);
+        if (!extensions)
+            return GLFW_TRUE;
+
+        size += strlen(extensions) + 1;
+    }
+
+    if (platform)
+        size += strlen(platform) + 1;
+
+    char* names = _glfw_calloc(size, 1);
+    if (!names)
+        return GLFW_FALSE;
+
+    char* end = names;
+
+    for (i = 0;  i < count;  i++)
+        end = copyExtensionNames(end, (const char*) context->GetStringi(GL_EXTENSIONS, i));
+
+    if (extensions)
+        end = copyExtensionNames(end, extensions);
+    if (platform)
+        end = copyExtensionNames(end, platform);
+
+    int nameCount = 0;
+    for (const char* name = names;  name < end;  name += strlen(name) + 1)
+        nameCount++;
+
+    // Keep the load factor at or below one half
+    int indexSize = 64;
+    while (nameCount * 2 > indexSize)
+        indexSize *= 2;
+
+    int* index = _glfw_calloc(indexSize, sizeof(int));
+    if (!index)
+    {
+        _glfw_free(names);
+        return GLFW_FALSE;
+    }
+
+    _glfw_free(context->extensionNames);
+    _glfw_free(context->extensionIndex);
+    context->extensionNames = names;
+    context->extensionIndex = index;
+    context->extensionIndexSize = indexSize;
+
+    for (const char* name = names;  name < end;  name += strlen(name) + 1)
+    {
+        int* slot = findExtensionSlot(context, name);
+        if (*slot == 0)
+            *slot = (int) (name - names) + 1;
+    }
+
+    return GLFW_TRUE;
+}
+
+// Returns the cache entry for the specified entry point name
+// The entry is either empty or holds that name
+//
+static _GLFWprocentry* findProcEntry(const _GLFWproccache* cache, const char* name)
+{
+    const int mask = cache->entrySize - 1;
+    int i = (int) (hashName(name) & (uint32_t) mask);
+
+    for (;;)
+    {
+        _GLFWprocentry* entry = cache->entries + i;
+        if (entry->name == 0 || strcmp(cache->names + entry->name - 1, name) == 0)
+            return entry;
+
+        i = (i + 1) & mask;
+    }
+}
+
+// Adds a resolved entry point to the cache
+// The cache lock must be held
+//
+static void cacheProc(_GLFWproccache* cache, const char* name, GLFWglproc proc)
+{
+    const size_t length = strlen(name) + 1;
+
+    // Keep the load factor at or below one half
+    if ((cache->entryCount + 1) * 2 > cache->entrySize)
+    {
+        int i;
+        const int size = cache->entrySize ? cache->entrySize * 2 : 256;
+        _GLFWprocentry* previous = cache->entries;
+        const int previousSize = cache->entrySize;
+
+        cache->entries = _glfw_calloc(size, sizeof(_GLFWprocentry));
+        if (!cache->entries)
+        {
+            cache->entries = previous;
+            return;
+        }
+
+        cache->entrySize = size;
+
+        for (i = 0;  i < previousSize;  i++)
+        {
+            if (previous[i].name)
+                *findProcEntry(cache, cache->names + previous[i].name - 1) = previous[i];
+        }
+
+        _glfw_free(previous);
+    }
+
+    if (cache->nameSize + length > cache->nameCapacity)
+    {
+        size_t capacity = cache->nameCapacity ? cache->nameCapacity * 2 : 4096;
+        while (cache->nameSize + length > capacity)
+            capacity *= 2;
+
+        char* names = _glfw_realloc(cache->names, capacity);
+        if (!names)
+            return;
+
+        cache->names = names;
+        cache->nameCapacity = capacity;
+    }
+
+    _GLFWprocentry* entry = findProcEntry(cache, name);
+    memcpy(cache->names + cache->nameSize, name, length);
+    entry->name = (int) cache->nameSize + 1;
+    entry->proc = proc;
+    cache->nameSize += length;
+    cache->entryCount++;
+}
+
+// Returns the entry point with the specified name for the current context,
+// resolving and caching it on first use
+// The cache lock must be held
+//
+static GLFWglproc getCachedProc(_GLFWwindow* window, const char* name)
+{
+    _GLFWproccache* cache = window->context.procs;
+
+    if (cache->entrySize)
+    {
+        const _GLFWprocentry* entry = findProcEntry(cache, name);
+        if (entry->name)
+            return entry->proc;
+    }
+
+    const GLFWglproc proc = window->context.getProcAddress(name);
+    cacheProc(cache, name, proc);
+    return proc;
+}
+
+// Attaches an entry point cache to the specified context, sharing an existing
+// one with the same context creation API and client library where possible
+//
+static void acquireProcCache(_GLFWwindow* window, const _GLFWctxconfig* ctxconfig)
+{
+    _GLFWproccache* cache = NULL;
+    const GLFWbool es1 = ctxconfig->client == GLFW_OPENGL_ES_API &&
+                         ctxconfig->major == 1;
+
+    // WGL entry points may differ between pixel formats, so native contexts on
+    // Windows only share their cache with their share group
+    const GLFWbool shared =
+        _glfw.platform.platformID != GLFW_PLATFORM_WIN32 ||
+        window->context.source != GLFW_NATIVE_CONTEXT_API;
+
+    if (shared)
+    {
+        for (cache = _glfw.procCacheListHead;  cache;  cache = cache->next)
+        {
+            if (cache->shared &&
+                cache->getProcAddress == window->context.getProcAddress &&
+                cache->client == window->context.client &&
+                cache->es1 == es1)
+            {
+                break;
+            }
+        }
+    }
+    else if (ctxconfig->share && ctxconfig->share->context.procs)
+    {
+        cache = ctxconfig->share->context.procs;
+        if (cache->getProcAddress != window->context.getProcAddress ||
+            cache->client != window->context.client ||
+            cache->es1 != es1)
+        {
+            cache = NULL;
+        }
+    }
+
+    if (!cache)
+    {
+        cache = _glfw_calloc(1, sizeof(_GLFWproccache));
+        if (!cache)
+            return;
+
+        if (!_glfwPlatformCreateMutex(&cache->lock))
+        {
+            _glfw_free(cache);
+            return;
+        }
+
+        cache->shared = shared;
+        cache->getProcAddress = window->context.getProcAddress;
+        cache->client = window->context.client;
+        cache->es1 = es1;
+        cache->next = _glfw.procCacheListHead;
+        _glfw.procCacheListHead = cache;
+    }
+
+    cache->refcount++;
+    window->context.procs = cache;
+}
+
+// Returns whether two sets of framebuffer hints are the same
+//
+static GLFWbool isSameFBConfig(const _GLFWfbconfig* a, const _GLFWfbconfig* b)
+{
+    return a->redBits == b->redBits &&
+           a->greenBits == b->greenBits &&
+           a->blueBits == b->blueBits &&
+           a->alphaBits == b->alphaBits &&
+           a->depthBits == b->depthBits &&
+           a->stencilBits == b->stencilBits &&
+           a->accumRedBits == b->accumRedBits &&
+           a->accumGreenBits == b->accumGreenBits &&
+           a->accumBlueBits == b->accumBlueBits &&
+           a->accumAlphaBits == b->accumAlphaBits &&
+           a->auxBuffers == b->auxBuffers &&
+           a->stereo == b->stereo &&
+           a->samples == b->samples &&
+           a->sRGB == b->sRGB &&
+           a->doublebuffer == b->doublebuffer &&
+           a->transparent == b->transparent;
+}
+
+// Creates the asynchronous readback ring of the current context
+//
+static GLFWbool createReadback(_GLFWwindow* window)
+{
+    _GLFWreadback* readback;
+    GLFWbool supported;
+
+    if (window->context.client == GLFW_OPENGL_ES_API)
+        supported = window->context.major >= 3;
+    else if (window->context.major == 3 && window->context.minor < 2)
+        supported = hasExtension(&window->context, "GL_ARB_sync");
+    else
+        supported = window->context.major >= 3;
+
+    if (!supported)
+    {
+        _glfwInputError(GLFW_VERSION_UNAVAILABLE,
+                        "Asynchronous readback requires OpenGL 3.2, OpenGL 3.0 with GL_ARB_sync or OpenGL ES 3.0");
+        return GLFW_FALSE;
+    }
+
+    readback = _glfw_calloc(1, sizeof(_GLFWreadback));
+    if (!readback)
+        return GLFW_FALSE;
+
+    readback->Flush = (PFNGLFLUSHPROC)
+        window->context.getProcAddress("glFlush");
+    readback->PixelStorei = (PFNGLPIXELSTOREIPROC)
+        window->context.getProcAddress("glPixelStorei");
+    readback->ReadPixels = (PFNGLREADPIXELSPROC)
+        window->context.getProcAddress("glReadPixels");
+    readback->ReadBuffer = (PFNGLREADBUFFERPROC)
+        window->context.getProcAddress("glReadBuffer");
+    readback->GenBuffers = (PFNGLGENBUFFERSPROC)
+        window->context.getProcAddress("glGenBuffers");
+    readback->DeleteBuffers = (PFNGLDELETEBUFFERSPROC)
+        window->context.getProcAddress("glDeleteBuffers");
+    readback->BindBuffer = (PFNGLBINDBUFFERPROC)
+        window->context.getProcAddress("glBindBuffer");
+    readback->BufferData = (PFNGLBUFFERDATAPROC)
+        window->context.getProcAddress("glBufferData");
+    readback->MapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+        window->context.getProcAddress("glMapBufferRange");
+    readback->UnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+        window->context.getProcAddress("glUnmapBuffer");
+    readback->BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)
+        window->context.getProcAddress("glBindFramebuffer");
+    readback->FenceSync = (PFNGLFENCESYNCPROC)
+        window->context.getProcAddress("glFenceSync");
+    readback->ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+        window->context.getProcAddress("glClientWaitSync");
+    readback->DeleteSync = (PFNGLDELETESYNCPROC)
+        window->context.getProcAddress("glDeleteSync");
+
+    if (!readback->Flush ||
+        !readback->PixelStorei ||
+        !readback->ReadPixels ||
+        !readback->ReadBuffer ||
+        !readback->GenBuffers ||
+        !readback->DeleteBuffers ||
+        !readback->BindBuffer ||
+        !readback->BufferData ||
+        !readback->MapBufferRange ||
+        !readback->UnmapBuffer ||
+        !readback->BindFramebuffer ||
+        !readback->FenceSync ||
+        !readback->ClientWaitSync ||
+        !readback->DeleteSync)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Entry points for asynchronous readback are missing");
+        _glfw_free(readback);
+        return GLFW_FALSE;
+    }
+
+    readback->count = window->context.readbackBuffers;
+    readback->slots = _glfw_calloc(readback->count, sizeof(_GLFWreadbackslot));
+    if (!readback->slots)
+    {
+        _glfw_free(readback);
+        return GLFW_FALSE;
+    }
+
+    for (int i = 0;  i < readback->count;  i++)
+        readback->GenBuffers(1, &readback->slots[i].buffer);
+
+    window->context.readback = readback;
+    return GLFW_TRUE;
+}
+
+// Passes the frame in the specified slot to the readback callback once it has
+// been copied, waiting for at most the specified number of nanoseconds
+//
+static GLFWbool deliverReadback(_GLFWwindow* window,
+                                _GLFWreadbackslot* slot,
+                                GLuint64 timeout)
+{
+    _GLFWreadback* readback = window->context.readback;
+    GLint previous;
+    GLenum result;
+    void* pixels;
+
+    result = readback->ClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    if (result == GL_TIMEOUT_EXPIRED)
+        return GLFW_FALSE;
+
+    // The slot is freed before calling back, in case the callback reads back
+    readback->DeleteSync(slot->fence);
+    slot->fence = NULL;
+
+    if (result == GL_WAIT_FAILED)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to wait for asynchronous readback");
+        return GLFW_TRUE;
+    }
+
+    if (!window->callbacks.readback)
+        return GLFW_TRUE;
+
+    window->context.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previous);
+    readback->BindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+    pixels = readback->MapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+                                      (GLsizeiptr) slot->width * slot->height * 4,
+                                      GL_MAP_READ_BIT);
+    readback->BindBuffer(GL_PIXEL_PACK_BUFFER, previous);
+
+    if (!pixels)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to map asynchronous readback buffer");
+        return GLFW_TRUE;
+    }
+
+    const GLFWimage image = { slot->width, slot->height, pixels };
+    window->callbacks.readback((GLFWwindow*) window, &image, slot->frame);
+
+    window->context.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previous);
+    readback->BindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+    readback->UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    readback->BindBuffer(GL_PIXEL_PACK_BUFFER, previous);
+    return GLFW_TRUE;
+}
+
+// Passes the frames that have been copied to the readback callback in the
+// order they were rendered, optionally waiting for all of them
+//
+static void drainReadback(_GLFWwindow* window, GLFWbool wait)
+{
+    _GLFWreadback* readback = window->context.readback;
+
+    for (int i = 0;  i < readback->count;  i++)
+    {
+        _GLFWreadbackslot* slot =
+            readback->slots + (readback->next + i) % readback->count;
+
+        if (!slot->fence)
+            continue;
+
+        if (!deliverReadback(window, slot, wait ? GL_TIMEOUT_IGNORED : 0))
+            break;
+    }
+}
+
+// Starts copying the default framebuffer of the current context into the next
+// readback slot, first waiting for the frame in that slot if it is pending
+//
+static void queueReadback(_GLFWwindow* window)
+{
+    _GLFWreadback* readback = window->context.readback;
+    _GLFWreadbackslot* slot = readback->slots + readback->next;
+    GLint previousBuffer, previousFramebuffer, previousReadBuffer, previousAlignment;
+    int width, height;
+
+    drainReadback(window, GLFW_FALSE);
+
+    if (slot->fence)
+    {
+        _GLFW_COUNT_ATOMIC(GLFW_READBACK_STALLS, 1);
+        deliverReadback(window, slot, GL_TIMEOUT_IGNORED);
+    }
+
+    _glfw.platform.getFramebufferSize(window, &width, &height);
+    if (width <= 0 || height <= 0)
+    {
+        readback->frame++;
+        return;
+    }
+
+    const GLsizeiptr size = (GLsizeiptr) width * height * 4;
+
+    window->context.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previousBuffer);
+    window->context.GetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    window->context.GetIntegerv(GL_PACK_ALIGNMENT, &previousAlignment);
+
+    readback->BindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+    if (slot->size < size)
+    {
+        readback->BufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        slot->size = size;
+    }
+
+    readback->BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    // The read buffer is state of the default framebuffer, so it is only
+    // queried once that is bound
+    window->context.GetIntegerv(GL_READ_BUFFER, &previousReadBuffer);
+
+    // The frame being swapped is in the back buffer, while OpenGL ES only
+    // accepts GL_BACK for the one color buffer of single-buffered windows
+    if (window->doublebuffer || window->context.client == GLFW_OPENGL_ES_API)
+        readback->ReadBuffer(GL_BACK);
+    else
+        readback->ReadBuffer(GL_FRONT);
+
+    readback->PixelStorei(GL_PACK_ALIGNMENT, 4);
+    readback->ReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+    readback->PixelStorei(GL_PACK_ALIGNMENT, previousAlignment);
+    readback->ReadBuffer((GLenum) previousReadBuffer);
+    readback->BindFramebuffer(GL_READ_FRAMEBUFFER, previousFramebuffer);
+    readback->BindBuffer(GL_PIXEL_PACK_BUFFER, previousBuffer);
+
+    slot->fence = readback->FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot->width = width;
+    slot->height = height;
+    slot->frame = readback->frame++;
+    readback->next = (readback->next + 1) % readback->count;
+
+    // Make sure the copy starts even if the buffer swap does not flush
+    readback->Flush();
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -66,6 +627,14 @@ GLFWbool _glfwIsValidContextConfig(const _GLFWctxconfig* ctxconfig)
         return GLFW_FALSE;
     }
 
+    if (ctxconfig->readbackBuffers < 1)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid readback buffer count %i",
+                        ctxconfig->readbackBuffers);
+        return GLFW_FALSE;
+    }
+
     if (ctxconfig->share)
     {
         if (ctxconfig->client == GLFW_NO_API ||
@@ -340,6 +909,60 @@ const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
     return closest;
 }
 
+// Returns the handle of the config previously chosen for the specified hints,
+// or zero if there is none
+//
+uintptr_t _glfwFindFBConfigChoice(const _GLFWfbconfigcache* cache,
+                                  const _GLFWfbconfig* desired,
+                                  int mask)
+{
+    if (!cache)
+        return 0;
+
+    for (int i = 0;  i < cache->choiceCount;  i++)
+    {
+        const _GLFWfbconfigchoice* choice = cache->choices + i;
+
+        if (choice->mask == mask && isSameFBConfig(&choice->desired, desired))
+            return choice->handle;
+    }
+
+    return 0;
+}
+
+// Remembers the config chosen for the specified hints
+//
+void _glfwAddFBConfigChoice(_GLFWfbconfigcache* cache,
+                            const _GLFWfbconfig* desired,
+                            int mask,
+                            uintptr_t handle)
+{
+    _GLFWfbconfigchoice* choices =
+        _glfw_realloc(cache->choices,
+                      sizeof(_GLFWfbconfigchoice) * (cache->choiceCount + 1));
+    if (!choices)
+        return;
+
+    cache->choices = choices;
+    cache->choices[cache->choiceCount].desired = *desired;
+    cache->choices[cache->choiceCount].mask = mask;
+    cache->choices[cache->choiceCount].handle = handle;
+    cache->choiceCount++;
+}
+
+// Frees a framebuffer config cache and the choices made from it
+//
+void _glfwFreeFBConfigCache(_GLFWfbconfigcache* cache)
+{
+    if (!cache)
+        return;
+
+    _glfw_free(cache->configs);
+    _glfw_free(cache->masks);
+    _glfw_free(cache->choices);
+    _glfw_free(cache);
+}
+
 // Retrieves the attributes of the current context
 //
 GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
@@ -358,6 +981,7 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
 
     window->context.source = ctxconfig->source;
     window->context.client = GLFW_OPENGL_API;
+    window->context.readbackBuffers = ctxconfig->readbackBuffers;
 
     previous = _glfwPlatformGetTls(&_glfw.contextSlot);
     glfwMakeContextCurrent((GLFWwindow*) window);
@@ -472,6 +1096,14 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
         }
     }
 
+    if (!buildExtensionSet(window))
+    {
+        glfwMakeContextCurrent((GLFWwindow*) previous);
+        return GLFW_FALSE;
+    }
+
+    acquireProcCache(window, ctxconfig);
+
     if (window->context.client == GLFW_OPENGL_API)
     {
         // Read back context flags (OpenGL 3.0 and above)
@@ -580,6 +1212,60 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
     return GLFW_TRUE;
 }
 
+// Detaches the entry point cache of the specified context, destroying it if no
+// other context uses it
+//
+void _glfwReleaseProcCache(_GLFWwindow* window)
+{
+    _GLFWproccache* cache = window->context.procs;
+    if (!cache)
+        return;
+
+    window->context.procs = NULL;
+
+    if (--cache->refcount)
+        return;
+
+    _GLFWproccache** prev = &_glfw.procCacheListHead;
+
+    while (*prev != cache)
+        prev = &((*prev)->next);
+
+    *prev = cache->next;
+
+    _glfwPlatformDestroyMutex(&cache->lock);
+    _glfw_free(cache->names);
+    _glfw_free(cache->entries);
+    _glfw_free(cache);
+}
+
+// Frees the asynchronous readback ring of the window, discarding any frames
+// still being copied
+//
+void _glfwFreeReadback(_GLFWwindow* window)
+{
+    _GLFWreadback* readback = window->context.readback;
+    if (!readback)
+        return;
+
+    // The buffers can only be deleted while the context is current, otherwise
+    // they are deleted along with the context or its share group
+    if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
+    {
+        for (int i = 0;  i < readback->count;  i++)
+        {
+            if (readback->slots[i].fence)
+                readback->DeleteSync(readback->slots[i].fence);
+
+            readback->DeleteBuffers(1, &readback->slots[i].buffer);
+        }
+    }
+
+    _glfw_free(readback->slots);
+    _glfw_free(readback);
+    window->context.readback = NULL;
+}
+
 // Searches an extension string for the specified extension
 //
 GLFWbool _glfwStringInExtensionString(const char* string, const char* extensions)
@@ -629,6 +1315,20 @@ GLFWAPI void glfwMakeContextCurrent(GLFWwindow* handle)
         return;
     }
 
+    // Making the current context current again would still cost a full call
+    // into the driver, which may flush the pipeline.  This is only skipped if
+    // the context creation API confirms the call would change nothing, as the
+    // application may have made a context current without GLFW
+    if (window == previous &&
+        (!window || (window->context.isCurrent &&
+                     window->context.isCurrent(window))))
+    {
+        _GLFW_COUNT_ATOMIC(GLFW_CONTEXT_SWITCHES_ELIDED, 1);
+        return;
+    }
+
+    const uint64_t start = _glfwPlatformGetTimerValue();
+
     if (previous)
     {
         if (!window || window->context.source != previous->context.source)
@@ -637,6 +1337,9 @@ GLFWAPI void glfwMakeContextCurrent(GLFWwindow* handle)
 
     if (window)
         window->context.makeCurrent(window);
+
+    _GLFW_COUNT_ATOMIC(GLFW_CONTEXT_SWITCHES, 1);
+    _GLFW_COUNT_ATOMIC(GLFW_CONTEXT_SWITCH_TIME, _glfwPlatformGetTimerValue() - start);
 }
 
 GLFWAPI GLFWwindow* glfwGetCurrentContext(void)
@@ -659,6 +1362,17 @@ GLFWAPI void glfwSwapBuffers(GLFWwindow* handle)
         return;
     }
 
+    if (window->callbacks.readback)
+    {
+        if (window != _glfwPlatformGetTls(&_glfw.contextSlot))
+        {
+            _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                            "Cannot read back a window whose context is not current on the calling thread");
+        }
+        else if (window->context.readback || createReadback(window))
+            queueReadback(window);
+    }
+
     window->context.swapBuffers(window);
 }
 
@@ -700,66 +1414,169 @@ GLFWAPI int glfwExtensionSupported(const char* extension)
         return GLFW_FALSE;
     }
 
-    if (window->context.major >= 3)
+    if (!window->context.extensionIndex)
     {
-        int i;
-        GLint count;
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Extension string retrieval is broken");
+        return GLFW_FALSE;
+    }
 
-        // Check if extension is in the modern OpenGL extensions string list
+    return *findExtensionSlot(&window->context, extension) != 0;
+}
 
-        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
+{
+    _GLFWwindow* window;
+    assert(procname != NULL);
 
-        for (i = 0;  i < count;  i++)
-        {
-            const char* en = (const char*)
-                window->context.GetStringi(GL_EXTENSIONS, i);
-            if (!en)
-            {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "Extension string retrieval is broken");
-                return GLFW_FALSE;
-            }
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-            if (strcmp(en, extension) == 0)
-                return GLFW_TRUE;
-        }
-    }
-    else
+    window = _glfwPlatformGetTls(&_glfw.contextSlot);
+    if (!window)
     {
-        // Check if extension is in the old style OpenGL extensions string
-
-        const char* extensions = (const char*)
-            window->context.GetString(GL_EXTENSIONS);
-        if (!extensions)
-        {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "Extension string retrieval is broken");
-            return GLFW_FALSE;
-        }
-
-        if (_glfwStringInExtensionString(extension, extensions))
-            return GLFW_TRUE;
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot query entry point without a current OpenGL or OpenGL ES context");
+        return NULL;
     }
 
-    // Check if extension is in the platform-specific string
-    return window->context.extensionSupported(extension);
+    if (!window->context.procs)
+        return window->context.getProcAddress(procname);
+
+    _glfwPlatformLockMutex(&window->context.procs->lock);
+    const GLFWglproc proc = getCachedProc(window, procname);
+    _glfwPlatformUnlockMutex(&window->context.procs->lock);
+    return proc;
 }
 
-GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
+GLFWAPI int glfwGetProcAddresses(const char** procnames, GLFWglproc* procs, int count)
 {
+    int i, found = 0;
     _GLFWwindow* window;
-    assert(procname != NULL);
+    assert(procnames != NULL || count == 0);
+    assert(procs != NULL || count == 0);
 
-    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
 
     window = _glfwPlatformGetTls(&_glfw.contextSlot);
     if (!window)
     {
         _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
-                        "Cannot query entry point without a current OpenGL or OpenGL ES context");
+                        "Cannot query entry points without a current OpenGL or OpenGL ES context");
+        return 0;
+    }
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid entry point count %i", count);
+        return 0;
+    }
+
+    if (window->context.procs)
+        _glfwPlatformLockMutex(&window->context.procs->lock);
+
+    for (i = 0;  i < count;  i++)
+    {
+        assert(procnames[i] != NULL);
+
+        if (window->context.procs)
+            procs[i] = getCachedProc(window, procnames[i]);
+        else
+            procs[i] = window->context.getProcAddress(procnames[i]);
+
+        if (procs[i])
+            found++;
+    }
+
+    if (window->context.procs)
+        _glfwPlatformUnlockMutex(&window->context.procs->lock);
+
+    return found;
+}
+
+GLFWAPI int glfwPreloadFramebufferConfigs(void)
+{
+    _GLFWfbconfig fbconfig;
+    _GLFWctxconfig ctxconfig;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    fbconfig  = _glfw.hints.framebuffer;
+    ctxconfig = _glfw.hints.context;
+
+    if (!_glfwIsValidContextConfig(&ctxconfig))
+        return GLFW_FALSE;
+
+    if (ctxconfig.client == GLFW_NO_API)
+        return GLFW_TRUE;
+
+    // Native contexts on Wayland are created with EGL
+    if (ctxconfig.source == GLFW_EGL_CONTEXT_API ||
+        (ctxconfig.source == GLFW_NATIVE_CONTEXT_API &&
+         _glfw.platform.platformID == GLFW_PLATFORM_WAYLAND))
+    {
+        if (!_glfwInitEGL())
+            return GLFW_FALSE;
+
+        return _glfwPreloadConfigsEGL(&ctxconfig, &fbconfig);
+    }
+
+#if defined(_GLFW_X11)
+    if (ctxconfig.source == GLFW_NATIVE_CONTEXT_API &&
+        _glfw.platform.platformID == GLFW_PLATFORM_X11)
+    {
+        if (!_glfwInitGLX())
+            return GLFW_FALSE;
+
+        return _glfwPreloadFBConfigsGLX(&fbconfig);
+    }
+#endif // _GLFW_X11
+
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "Framebuffer configs cannot be preloaded for this context creation API");
+    return GLFW_FALSE;
+}
+
+GLFWAPI GLFWreadbackfun glfwSetReadbackCallback(GLFWwindow* handle,
+                                                GLFWreadbackfun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot read back a window that has no OpenGL or OpenGL ES context");
         return NULL;
     }
 
-    return window->context.getProcAddress(procname);
+    _GLFW_SWAP(GLFWreadbackfun, window->callbacks.readback, cbfun);
+    return cbfun;
+}
+
+GLFWAPI void glfwFinishReadback(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot read back a window that has no OpenGL or OpenGL ES context");
+        return;
+    }
+
+    if (window != _glfwPlatformGetTls(&_glfw.contextSlot))
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot read back a window whose context is not current on the calling thread");
+        return;
+    }
+
+    if (window->context.readback)
+        drainReadback(window, GLFW_TRUE);
 }
 
@@ -83,39 +83,25 @@ static int getEGLConfigAttrib(EGLConfig config, int attrib)
     return value;
 }
 
-// Return the EGLConfig most closely matching the specified hints
+// Translates the EGLConfigs of the display the first time they are needed
 //
-static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
-                                const _GLFWfbconfig* fbconfig,
-                                EGLConfig* result)
+// The table keeps every config the display can render to regardless of the
+// hints, so that later windows can choose from it without querying EGL again
+//
+static GLFWbool loadEGLConfigs(void)
 {
     EGLConfig* nativeConfigs;
-    _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
-    int i, nativeCount, usableCount, apiBit, surfaceTypeBit;
-    GLFWbool wrongApiAvailable = GLFW_FALSE;
+    _GLFWfbconfigcache* cache;
+    int i, nativeCount, surfaceTypeBit;
 
-    if (ctxconfig->client == GLFW_OPENGL_ES_API)
-    {
-        if (ctxconfig->major == 1)
-            apiBit = EGL_OPENGL_ES_BIT;
-        else
-            apiBit = EGL_OPENGL_ES2_BIT;
-    }
-    else
-        apiBit = EGL_OPENGL_BIT;
+    if (_glfw.egl.configs)
+        return GLFW_TRUE;
 
     if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
         surfaceTypeBit = EGL_PBUFFER_BIT;
     else
         surfaceTypeBit = EGL_WINDOW_BIT;
 
-    if (fbconfig->stereo)
-    {
-        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
-        return GLFW_FALSE;
-    }
-
     eglGetConfigs(_glfw.egl.display, NULL, 0, &nativeCount);
     if (!nativeCount)
     {
@@ -126,13 +112,14 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
     nativeConfigs = _glfw_calloc(nativeCount, sizeof(EGLConfig));
     eglGetConfigs(_glfw.egl.display, nativeConfigs, nativeCount, &nativeCount);
 
-    usableConfigs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
-    usableCount = 0;
+    cache = _glfw_calloc(1, sizeof(_GLFWfbconfigcache));
+    cache->configs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
+    cache->masks = _glfw_calloc(nativeCount, sizeof(int));
 
     for (i = 0;  i < nativeCount;  i++)
     {
         const EGLConfig n = nativeConfigs[i];
-        _GLFWfbconfig* u = usableConfigs + usableCount;
+        _GLFWfbconfig* u = cache->configs + cache->count;
 
         // Only consider RGB(A) EGLConfigs
         if (getEGLConfigAttrib(n, EGL_COLOR_BUFFER_TYPE) != EGL_RGB_BUFFER)
@@ -145,32 +132,23 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         if (_glfw.platform.platformID == GLFW_PLATFORM_X11)
         {
             XVisualInfo vi = {0};
+            int count;
 
             // Only consider EGLConfigs with associated Visuals
             vi.visualid = getEGLConfigAttrib(n, EGL_NATIVE_VISUAL_ID);
             if (!vi.visualid)
                 continue;
 
-            if (fbconfig->transparent)
+            XVisualInfo* vis =
+                XGetVisualInfo(_glfw.x11.display, VisualIDMask, &vi, &count);
+            if (vis)
             {
-                int count;
-                XVisualInfo* vis =
-                    XGetVisualInfo(_glfw.x11.display, VisualIDMask, &vi, &count);
-                if (vis)
-                {
-                    u->transparent = _glfwIsVisualTransparentX11(vis[0].visual);
-                    XFree(vis);
-                }
+                u->transparent = _glfwIsVisualTransparentX11(vis[0].visual);
+                XFree(vis);
             }
         }
 #endif // _GLFW_X11
 
-        if (!(getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE) & apiBit))
-        {
-            wrongApiAvailable = GLFW_TRUE;
-            continue;
-        }
-
         u->redBits = getEGLConfigAttrib(n, EGL_RED_SIZE);
         u->greenBits = getEGLConfigAttrib(n, EGL_GREEN_SIZE);
         u->blueBits = getEGLConfigAttrib(n, EGL_BLUE_SIZE);
@@ -179,6 +157,71 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         u->depthBits = getEGLConfigAttrib(n, EGL_DEPTH_SIZE);
         u->stencilBits = getEGLConfigAttrib(n, EGL_STENCIL_SIZE);
 
+        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
+
+        u->handle = (uintptr_t) n;
+        cache->masks[cache->count] = getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE);
+        cache->count++;
+    }
+
+    _glfw_free(nativeConfigs);
+
+    _glfw.egl.configs = cache;
+    return GLFW_TRUE;
+}
+
+// Return the EGLConfig most closely matching the specified hints
+//
+static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
+                                const _GLFWfbconfig* fbconfig,
+                                EGLConfig* result)
+{
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    int i, usableCount, apiBit;
+    GLFWbool wrongApiAvailable = GLFW_FALSE;
+    uintptr_t handle;
+
+    if (ctxconfig->client == GLFW_OPENGL_ES_API)
+    {
+        if (ctxconfig->major == 1)
+            apiBit = EGL_OPENGL_ES_BIT;
+        else
+            apiBit = EGL_OPENGL_ES2_BIT;
+    }
+    else
+        apiBit = EGL_OPENGL_BIT;
+
+    if (fbconfig->stereo)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
+        return GLFW_FALSE;
+    }
+
+    handle = _glfwFindFBConfigChoice(_glfw.egl.configs, fbconfig, apiBit);
+    if (handle)
+    {
+        *result = (EGLConfig) handle;
+        return GLFW_TRUE;
+    }
+
+    if (!loadEGLConfigs())
+        return GLFW_FALSE;
+
+    usableConfigs = _glfw_calloc(_glfw.egl.configs->count, sizeof(_GLFWfbconfig));
+    usableCount = 0;
+
+    for (i = 0;  i < _glfw.egl.configs->count;  i++)
+    {
+        const _GLFWfbconfig* n = _glfw.egl.configs->configs + i;
+        _GLFWfbconfig* u = usableConfigs + usableCount;
+
+        if (!(_glfw.egl.configs->masks[i] & apiBit))
+        {
+            wrongApiAvailable = GLFW_TRUE;
+            continue;
+        }
+
 #if defined(_GLFW_WAYLAND)
         if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
         {
@@ -188,22 +231,28 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
             //       with an alpha channel to ensure the buffer is opaque
             if (!_glfw.egl.EXT_present_opaque)
             {
-                if (!fbconfig->transparent && u->alphaBits > 0)
+                if (!fbconfig->transparent && n->alphaBits > 0)
                     continue;
             }
         }
 #endif // _GLFW_WAYLAND
 
-        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
+        *u = *n;
         u->doublebuffer = fbconfig->doublebuffer;
 
-        u->handle = (uintptr_t) n;
+        // Transparency is only considered when it was requested
+        if (!fbconfig->transparent)
+            u->transparent = GLFW_FALSE;
+
         usableCount++;
     }
 
     closest = _glfwChooseFBConfig(fbconfig, usableConfigs, usableCount);
     if (closest)
+    {
         *result = (EGLConfig) closest->handle;
+        _glfwAddFBConfigChoice(_glfw.egl.configs, fbconfig, apiBit, closest->handle);
+    }
     else
     {
         if (wrongApiAvailable)
@@ -234,12 +283,73 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         }
     }
 
-    _glfw_free(nativeConfigs);
     _glfw_free(usableConfigs);
 
     return closest != NULL;
 }
 
+// Creates a pbuffer of the specified size to act as the default framebuffer of
+// a window on the surfaceless platform
+//
+static EGLSurface createPbufferSurface(_GLFWwindow* window,
+                                       EGLConfig config,
+                                       int width, int height)
+{
+    EGLint attribs[7];
+    int index = 0;
+
+    if (window->context.egl.sRGB && _glfw.egl.KHR_gl_colorspace)
+    {
+        attribs[index++] = EGL_GL_COLORSPACE_KHR;
+        attribs[index++] = EGL_GL_COLORSPACE_SRGB_KHR;
+    }
+
+    attribs[index++] = EGL_WIDTH;
+    attribs[index++] = _glfw_max(width, 1);
+    attribs[index++] = EGL_HEIGHT;
+    attribs[index++] = _glfw_max(height, 1);
+    attribs[index++] = EGL_NONE;
+
+    return eglCreatePbufferSurface(_glfw.egl.display, config, attribs);
+}
+
+// Replaces the pbuffer of the current context if its window has been resized,
+// as pbuffers have a fixed size
+//
+static void resizePbufferSurface(_GLFWwindow* window)
+{
+    EGLSurface surface;
+    int width, height;
+
+    _glfw.platform.getFramebufferSize(window, &width, &height);
+    if (width == window->context.egl.width && height == window->context.egl.height)
+        return;
+
+    surface = createPbufferSurface(window, window->context.egl.config, width, height);
+    if (surface == EGL_NO_SURFACE)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "EGL: Failed to resize pbuffer: %s",
+                        getEGLErrorString(eglGetError()));
+        return;
+    }
+
+    if (!eglMakeCurrent(_glfw.egl.display, surface, surface,
+                        window->context.egl.handle))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "EGL: Failed to make resized pbuffer current: %s",
+                        getEGLErrorString(eglGetError()));
+        eglDestroySurface(_glfw.egl.display, surface);
+        return;
+    }
+
+    eglDestroySurface(_glfw.egl.display, window->context.egl.surface);
+    window->context.egl.surface = surface;
+    window->context.egl.width = width;
+    window->context.egl.height = height;
+}
+
 static void makeContextCurrentEGL(_GLFWwindow* window)
 {
     if (window)
@@ -254,6 +364,10 @@ static void makeContextCurrentEGL(_GLFWwindow* window)
                             getEGLErrorString(eglGetError()));
             return;
         }
+
+        // The window may have been resized while the context was not current
+        if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
+            resizePbufferSurface(window);
     }
     else
     {
@@ -272,6 +386,31 @@ static void makeContextCurrentEGL(_GLFWwindow* window)
     _glfwPlatformSetTls(&_glfw.contextSlot, window);
 }
 
+static GLFWbool isContextCurrentEGL(_GLFWwindow* window)
+{
+    if (eglGetCurrentContext() != window->context.egl.handle ||
+        eglGetCurrentSurface(EGL_DRAW) != window->context.egl.surface ||
+        eglGetCurrentSurface(EGL_READ) != window->context.egl.surface)
+    {
+        return GLFW_FALSE;
+    }
+
+    // A pbuffer resize is still pending if the window was resized on another
+    // thread while the context was current here
+    if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
+    {
+        int width, height;
+        _glfw.platform.getFramebufferSize(window, &width, &height);
+        if (width != window->context.egl.width ||
+            height != window->context.egl.height)
+        {
+            return GLFW_FALSE;
+        }
+    }
+
+    return GLFW_TRUE;
+}
+
 static void swapBuffersEGL(_GLFWwindow* window)
 {
     if (window != _glfwPlatformGetTls(&_glfw.contextSlot))
@@ -291,6 +430,10 @@ static void swapBuffersEGL(_GLFWwindow* window)
 #endif
 
     eglSwapBuffers(_glfw.egl.display, window->context.egl.surface);
+
+    // The window may have been resized on another thread during the frame
+    if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
+        resizePbufferSurface(window);
 }
 
 static void swapIntervalEGL(int interval)
@@ -298,9 +441,14 @@ static void swapIntervalEGL(int interval)
     eglSwapInterval(_glfw.egl.display, interval);
 }
 
+static const char* getExtensionStringEGL(void)
+{
+    return eglQueryString(_glfw.egl.display, EGL_EXTENSIONS);
+}
+
 static int extensionSupportedEGL(const char* extension)
 {
-    const char* extensions = eglQueryString(_glfw.egl.display, EGL_EXTENSIONS);
+    const char* extensions = getExtensionStringEGL();
     if (extensions)
     {
         if (_glfwStringInExtensionString(extension, extensions))
@@ -428,6 +576,10 @@ GLFWbool _glfwInitEGL(void)
         _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglCreatePbufferSurface");
     _glfw.egl.MakeCurrent = (PFN_eglMakeCurrent)
         _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglMakeCurrent");
+    _glfw.egl.GetCurrentContext = (PFN_eglGetCurrentContext)
+        _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglGetCurrentContext");
+    _glfw.egl.GetCurrentSurface = (PFN_eglGetCurrentSurface)
+        _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglGetCurrentSurface");
     _glfw.egl.SwapBuffers = (PFN_eglSwapBuffers)
         _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglSwapBuffers");
     _glfw.egl.SwapInterval = (PFN_eglSwapInterval)
@@ -450,6 +602,8 @@ GLFWbool _glfwInitEGL(void)
         !_glfw.egl.CreateWindowSurface ||
         !_glfw.egl.CreatePbufferSurface ||
         !_glfw.egl.MakeCurrent ||
+        !_glfw.egl.GetCurrentContext ||
+        !_glfw.egl.GetCurrentSurface ||
         !_glfw.egl.SwapBuffers ||
         !_glfw.egl.SwapInterval ||
         !_glfw.egl.QueryString ||
@@ -549,6 +703,9 @@ GLFWbool _glfwInitEGL(void)
 //
 void _glfwTerminateEGL(void)
 {
+    _glfwFreeFBConfigCache(_glfw.egl.configs);
+    _glfw.egl.configs = NULL;
+
     if (_glfw.egl.display)
     {
         eglTerminate(_glfw.egl.display);
@@ -717,15 +874,6 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
             SET_ATTRIB(EGL_PRESENT_OPAQUE_EXT, !fbconfig->transparent);
     }
 
-    if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
-    {
-        int width, height;
-        _glfw.platform.getFramebufferSize(window, &width, &height);
-
-        SET_ATTRIB(EGL_WIDTH, width);
-        SET_ATTRIB(EGL_HEIGHT, height);
-    }
-
     SET_ATTRIB(EGL_NONE, EGL_NONE);
 
     native = _glfw.platform.getEGLNativeWindow(window);
@@ -740,8 +888,14 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
     else if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
     {
         // HACK: Use a pbuffer surface as the default framebuffer
+        _glfw.platform.getFramebufferSize(window,
+                                          &window->context.egl.width,
+                                          &window->context.egl.height);
+        window->context.egl.sRGB = fbconfig->sRGB;
         window->context.egl.surface =
-            eglCreatePbufferSurface(_glfw.egl.display, config, attribs);
+            createPbufferSurface(window, config,
+                                 window->context.egl.width,
+                                 window->context.egl.height);
     }
     else
     {
@@ -845,9 +999,10 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
     }
 
     window->context.makeCurrent = makeContextCurrentEGL;
+    window->context.isCurrent = isContextCurrentEGL;
     window->context.swapBuffers = swapBuffersEGL;
     window->context.swapInterval = swapIntervalEGL;
-    window->context.extensionSupported = extensionSupportedEGL;
+    window->context.getExtensionString = getExtensionStringEGL;
     window->context.getProcAddress = getProcAddressEGL;
     window->context.destroy = destroyContextEGL;
 
@@ -895,6 +1050,29 @@ GLFWbool _glfwChooseVisualEGL(const _GLFWwndconfig* wndconfig,
 }
 #endif // _GLFW_X11
 
+// Resizes the pbuffer of the window on the surfaceless platform if its context
+// is current on the calling thread, otherwise when the context is next made
+// current or its buffers swapped
+//
+void _glfwResizeSurfaceEGL(_GLFWwindow* window)
+{
+    if (_glfw.egl.platform != EGL_PLATFORM_SURFACELESS_MESA)
+        return;
+
+    if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
+        resizePbufferSurface(window);
+}
+
+// Translates the EGLConfigs and chooses one for the specified hints ahead of
+// window creation
+//
+GLFWbool _glfwPreloadConfigsEGL(const _GLFWctxconfig* ctxconfig,
+                                const _GLFWfbconfig* fbconfig)
+{
+    EGLConfig native;
+    return chooseEGLConfig(ctxconfig, fbconfig, &native);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
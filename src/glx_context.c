@@ -47,18 +47,22 @@ static int getGLXFBConfigAttrib(GLXFBConfig fbconfig, int attrib)
     return value;
 }
 
-// Return the GLXFBConfig most closely matching the specified hints
+// Translates the GLXFBConfigs of the screen the first time they are needed
 //
-static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
-                                  GLXFBConfig* result)
+// The table keeps every RGBA window config regardless of the hints, so that
+// later windows can choose from it without querying the server again
+//
+static GLFWbool loadGLXFBConfigs(void)
 {
     GLXFBConfig* nativeConfigs;
-    _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
-    int nativeCount, usableCount;
+    _GLFWfbconfigcache* cache;
+    int nativeCount;
     const char* vendor;
     GLFWbool trustWindowBit = GLFW_TRUE;
 
+    if (_glfw.glx.fbconfigs)
+        return GLFW_TRUE;
+
     // HACK: This is a (hopefully temporary) workaround for Chromium
     //       (VirtualBox GL) not setting the window bit on any GLXFBConfigs
     vendor = glXGetClientString(_glfw.x11.display, GLX_VENDOR);
@@ -73,13 +77,13 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
         return GLFW_FALSE;
     }
 
-    usableConfigs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
-    usableCount = 0;
+    cache = _glfw_calloc(1, sizeof(_GLFWfbconfigcache));
+    cache->configs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
 
     for (int i = 0;  i < nativeCount;  i++)
     {
         const GLXFBConfig n = nativeConfigs[i];
-        _GLFWfbconfig* u = usableConfigs + usableCount;
+        _GLFWfbconfig* u = cache->configs + cache->count;
 
         // Only consider RGBA GLXFBConfigs
         if (!(getGLXFBConfigAttrib(n, GLX_RENDER_TYPE) & GLX_RGBA_BIT))
@@ -92,17 +96,11 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
                 continue;
         }
 
-        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER) != desired->doublebuffer)
-            continue;
-
-        if (desired->transparent)
+        XVisualInfo* vi = glXGetVisualFromFBConfig(_glfw.x11.display, n);
+        if (vi)
         {
-            XVisualInfo* vi = glXGetVisualFromFBConfig(_glfw.x11.display, n);
-            if (vi)
-            {
-                u->transparent = _glfwIsVisualTransparentX11(vi->visual);
-                XFree(vi);
-            }
+            u->transparent = _glfwIsVisualTransparentX11(vi->visual);
+            XFree(vi);
         }
 
         u->redBits = getGLXFBConfigAttrib(n, GLX_RED_SIZE);
@@ -123,6 +121,9 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
         if (getGLXFBConfigAttrib(n, GLX_STEREO))
             u->stereo = GLFW_TRUE;
 
+        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER))
+            u->doublebuffer = GLFW_TRUE;
+
         if (_glfw.glx.ARB_multisample)
             u->samples = getGLXFBConfigAttrib(n, GLX_SAMPLES);
 
@@ -130,14 +131,62 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
             u->sRGB = getGLXFBConfigAttrib(n, GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB);
 
         u->handle = (uintptr_t) n;
+        cache->count++;
+    }
+
+    XFree(nativeConfigs);
+
+    _glfw.glx.fbconfigs = cache;
+    return GLFW_TRUE;
+}
+
+// Return the GLXFBConfig most closely matching the specified hints
+//
+static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
+                                  GLXFBConfig* result)
+{
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    int usableCount;
+    uintptr_t handle;
+
+    handle = _glfwFindFBConfigChoice(_glfw.glx.fbconfigs, desired, 0);
+    if (handle)
+    {
+        *result = (GLXFBConfig) handle;
+        return GLFW_TRUE;
+    }
+
+    if (!loadGLXFBConfigs())
+        return GLFW_FALSE;
+
+    usableConfigs = _glfw_calloc(_glfw.glx.fbconfigs->count, sizeof(_GLFWfbconfig));
+    usableCount = 0;
+
+    for (int i = 0;  i < _glfw.glx.fbconfigs->count;  i++)
+    {
+        const _GLFWfbconfig* n = _glfw.glx.fbconfigs->configs + i;
+        _GLFWfbconfig* u = usableConfigs + usableCount;
+
+        if (n->doublebuffer != desired->doublebuffer)
+            continue;
+
+        *u = *n;
+
+        // Transparency is only considered when it was requested
+        if (!desired->transparent)
+            u->transparent = GLFW_FALSE;
+
         usableCount++;
     }
 
     closest = _glfwChooseFBConfig(desired, usableConfigs, usableCount);
     if (closest)
+    {
         *result = (GLXFBConfig) closest->handle;
+        _glfwAddFBConfigChoice(_glfw.glx.fbconfigs, desired, 0, closest->handle);
+    }
 
-    XFree(nativeConfigs);
     _glfw_free(usableConfigs);
 
     return closest != NULL;
@@ -182,6 +231,12 @@ static void makeContextCurrentGLX(_GLFWwindow* window)
     _glfwPlatformSetTls(&_glfw.contextSlot, window);
 }
 
+static GLFWbool isContextCurrentGLX(_GLFWwindow* window)
+{
+    return glXGetCurrentContext() == window->context.glx.handle &&
+           glXGetCurrentDrawable() == window->context.glx.window;
+}
+
 static void swapBuffersGLX(_GLFWwindow* window)
 {
     glXSwapBuffers(_glfw.x11.display, window->context.glx.window);
@@ -207,10 +262,14 @@ static void swapIntervalGLX(int interval)
     }
 }
 
+static const char* getExtensionStringGLX(void)
+{
+    return glXQueryExtensionsString(_glfw.x11.display, _glfw.x11.screen);
+}
+
 static int extensionSupportedGLX(const char* extension)
 {
-    const char* extensions =
-        glXQueryExtensionsString(_glfw.x11.display, _glfw.x11.screen);
+    const char* extensions = getExtensionStringGLX();
     if (extensions)
     {
         if (_glfwStringInExtensionString(extension, extensions))
@@ -303,6 +362,10 @@ GLFWbool _glfwInitGLX(void)
         _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXDestroyContext");
     _glfw.glx.MakeCurrent = (PFNGLXMAKECURRENTPROC)
         _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXMakeCurrent");
+    _glfw.glx.GetCurrentContext = (PFNGLXGETCURRENTCONTEXTPROC)
+        _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXGetCurrentContext");
+    _glfw.glx.GetCurrentDrawable = (PFNGLXGETCURRENTDRAWABLEPROC)
+        _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXGetCurrentDrawable");
     _glfw.glx.SwapBuffers = (PFNGLXSWAPBUFFERSPROC)
         _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXSwapBuffers");
     _glfw.glx.QueryExtensionsString = (PFNGLXQUERYEXTENSIONSSTRINGPROC)
@@ -323,6 +386,8 @@ GLFWbool _glfwInitGLX(void)
         !_glfw.glx.QueryVersion ||
         !_glfw.glx.DestroyContext ||
         !_glfw.glx.MakeCurrent ||
+        !_glfw.glx.GetCurrentContext ||
+        !_glfw.glx.GetCurrentDrawable ||
         !_glfw.glx.SwapBuffers ||
         !_glfw.glx.QueryExtensionsString ||
         !_glfw.glx.CreateNewContext ||
@@ -433,6 +498,9 @@ void _glfwTerminateGLX(void)
     // NOTE: This function must not call any X11 functions, as it is called
     //       after XCloseDisplay (see _glfwTerminateX11 for details)
 
+    _glfwFreeFBConfigCache(_glfw.glx.fbconfigs);
+    _glfw.glx.fbconfigs = NULL;
+
     if (_glfw.glx.handle)
     {
         _glfwPlatformFreeModule(_glfw.glx.handle);
@@ -627,9 +695,10 @@ GLFWbool _glfwCreateContextGLX(_GLFWwindow* window,
     }
 
     window->context.makeCurrent = makeContextCurrentGLX;
+    window->context.isCurrent = isContextCurrentGLX;
     window->context.swapBuffers = swapBuffersGLX;
     window->context.swapInterval = swapIntervalGLX;
-    window->context.extensionSupported = extensionSupportedGLX;
+    window->context.getExtensionString = getExtensionStringGLX;
     window->context.getProcAddress = getProcAddressGLX;
     window->context.destroy = destroyContextGLX;
 
@@ -670,6 +739,23 @@ GLFWbool _glfwChooseVisualGLX(const _GLFWwndconfig* wndconfig,
     return GLFW_TRUE;
 }
 
+// Translates the GLXFBConfigs and chooses one for the specified hints ahead of
+// window creation
+//
+GLFWbool _glfwPreloadFBConfigsGLX(const _GLFWfbconfig* fbconfig)
+{
+    GLXFBConfig native;
+
+    if (!chooseGLXFBConfig(fbconfig, &native))
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "GLX: Failed to find a suitable GLXFBConfig");
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
@@ -61,6 +61,8 @@ static _GLFWinitconfig _glfwInitHints =
     .x11 =
     {
         .xcbVulkanSurface = GLFW_TRUE,
+        .eventBudget = 0,
+        .eventTimeBudget = 0
     },
     .wl =
     {
@@ -118,11 +120,26 @@ static void terminate(void)
     _glfw_free(_glfw.mappings);
     _glfw.mappings = NULL;
     _glfw.mappingCount = 0;
+    _glfw.mappingCapacity = 0;
+
+    _glfw_free(_glfw.mappingIndex);
+    _glfw.mappingIndex = NULL;
+    _glfw.mappingIndexSize = 0;
+
+    _glfw_free(_glfw.defaultMappingGUIDs);
+    _glfw.defaultMappingGUIDs = NULL;
+
+    _glfw_free(_glfw.waitFds);
+    _glfw.waitFds = NULL;
+    _glfw.waitFdCount = 0;
 
     _glfwTerminateVulkan();
     _glfw.platform.terminateJoysticks();
     _glfw.platform.terminate();
 
+    // The platform may have served these to a clipboard manager on termination
+    _glfwFreeClipboardItems();
+
     _glfw.initialized = GLFW_FALSE;
 
     while (_glfw.errorListHead)
@@ -134,11 +151,75 @@ static void terminate(void)
 
     _glfwPlatformDestroyTls(&_glfw.contextSlot);
     _glfwPlatformDestroyTls(&_glfw.errorSlot);
-    _glfwPlatformDestroyMutex(&_glfw.errorLock);
 
     memset(&_glfw, 0, sizeof(_glfw));
 }
 
+// Returns the description of the specified error
+//
+static const char* getErrorDescription(const _GLFWerror* error)
+{
+    if (error->description[0])
+        return error->description;
+
+    switch (error->code)
+    {
+        case GLFW_NOT_INITIALIZED:
+            return "The GLFW library is not initialized";
+        case GLFW_NO_CURRENT_CONTEXT:
+            return "There is no current context";
+        case GLFW_INVALID_ENUM:
+            return "Invalid argument for enum parameter";
+        case GLFW_INVALID_VALUE:
+            return "Invalid value for parameter";
+        case GLFW_OUT_OF_MEMORY:
+            return "Out of memory";
+        case GLFW_API_UNAVAILABLE:
+            return "The requested API is unavailable";
+        case GLFW_VERSION_UNAVAILABLE:
+            return "The requested API version is unavailable";
+        case GLFW_PLATFORM_ERROR:
+            return "A platform-specific error occurred";
+        case GLFW_FORMAT_UNAVAILABLE:
+            return "The requested format is unavailable";
+        case GLFW_NO_WINDOW_CONTEXT:
+            return "The specified window has no context";
+        case GLFW_CURSOR_UNAVAILABLE:
+            return "The specified cursor shape is unavailable";
+        case GLFW_FEATURE_UNAVAILABLE:
+            return "The requested feature cannot be implemented for this platform";
+        case GLFW_FEATURE_UNIMPLEMENTED:
+            return "The requested feature has not yet been implemented for this platform";
+        case GLFW_PLATFORM_UNAVAILABLE:
+            return "The requested platform is unavailable";
+        default:
+            return "ERROR: UNKNOWN GLFW ERROR";
+    }
+}
+
+// Reads the specified instrumentation counter without tearing, as it may be
+// updated on another thread and 64-bit loads are not atomic on every target
+//
+static uint64_t readCounter(int counter)
+{
+#if defined(_MSC_VER)
+    return (uint64_t)
+        InterlockedCompareExchange64((volatile LONG64*) &_glfw.counters[counter & 0xffff],
+                                     0, 0);
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+    return __atomic_load_n(&_glfw.counters[counter & 0xffff], __ATOMIC_RELAXED);
+#else
+    uint64_t value;
+
+    while (__sync_lock_test_and_set(&_glfw.counterLock, 1))
+        ;
+
+    value = _glfw.counters[counter & 0xffff];
+    __sync_lock_release(&_glfw.counterLock);
+    return value;
+#endif
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -299,6 +380,22 @@ void _glfw_free(void* block)
         _glfw.allocator.deallocate(block, _glfw.allocator.user);
 }
 
+#if !defined(_MSC_VER) && !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+
+// Adds to the specified instrumentation counter from any thread on targets
+// without 64-bit atomics, using a spin lock on a 32-bit word instead
+//
+void _glfwCountAtomic(int counter, uint64_t value)
+{
+    while (__sync_lock_test_and_set(&_glfw.counterLock, 1))
+        ;
+
+    _glfw.counters[counter & 0xffff] += value;
+    __sync_lock_release(&_glfw.counterLock);
+}
+
+#endif
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
@@ -309,73 +406,50 @@ void _glfw_free(void* block)
 void _glfwInputError(int code, const char* format, ...)
 {
     _GLFWerror* error;
-    char description[_GLFW_MESSAGE_SIZE];
-
-    if (format)
-    {
-        va_list vl;
-
-        va_start(vl, format);
-        vsnprintf(description, sizeof(description), format, vl);
-        va_end(vl);
-
-        description[sizeof(description) - 1] = '\0';
-    }
-    else
-    {
-        if (code == GLFW_NOT_INITIALIZED)
-            strcpy(description, "The GLFW library is not initialized");
-        else if (code == GLFW_NO_CURRENT_CONTEXT)
-            strcpy(description, "There is no current context");
-        else if (code == GLFW_INVALID_ENUM)
-            strcpy(description, "Invalid argument for enum parameter");
-        else if (code == GLFW_INVALID_VALUE)
-            strcpy(description, "Invalid value for parameter");
-        else if (code == GLFW_OUT_OF_MEMORY)
-            strcpy(description, "Out of memory");
-        else if (code == GLFW_API_UNAVAILABLE)
-            strcpy(description, "The requested API is unavailable");
-        else if (code == GLFW_VERSION_UNAVAILABLE)
-            strcpy(description, "The requested API version is unavailable");
-        else if (code == GLFW_PLATFORM_ERROR)
-            strcpy(description, "A platform-specific error occurred");
-        else if (code == GLFW_FORMAT_UNAVAILABLE)
-            strcpy(description, "The requested format is unavailable");
-        else if (code == GLFW_NO_WINDOW_CONTEXT)
-            strcpy(description, "The specified window has no context");
-        else if (code == GLFW_CURSOR_UNAVAILABLE)
-            strcpy(description, "The specified cursor shape is unavailable");
-        else if (code == GLFW_FEATURE_UNAVAILABLE)
-            strcpy(description, "The requested feature cannot be implemented for this platform");
-        else if (code == GLFW_FEATURE_UNIMPLEMENTED)
-            strcpy(description, "The requested feature has not yet been implemented for this platform");
-        else if (code == GLFW_PLATFORM_UNAVAILABLE)
-            strcpy(description, "The requested platform is unavailable");
-        else
-            strcpy(description, "ERROR: UNKNOWN GLFW ERROR");
-    }
 
     if (_glfw.initialized)
     {
         error = _glfwPlatformGetTls(&_glfw.errorSlot);
         if (!error)
         {
+            _GLFWerror* head;
+
             error = _glfw_calloc(1, sizeof(_GLFWerror));
             _glfwPlatformSetTls(&_glfw.errorSlot, error);
-            _glfwPlatformLockMutex(&_glfw.errorLock);
-            error->next = _glfw.errorListHead;
-            _glfw.errorListHead = error;
-            _glfwPlatformUnlockMutex(&_glfw.errorLock);
+
+            // Push the error onto the list without a lock, so threads do not
+            // serialize on their first error
+            do
+            {
+                head = _glfw.errorListHead;
+                error->next = head;
+            }
+            while (_glfwPlatformCompareExchangePointer((void* volatile*) &_glfw.errorListHead,
+                                                       head, error) != head);
         }
     }
     else
         error = &_glfwMainThreadError;
 
     error->code = code;
-    strcpy(error->description, description);
+
+    // Only formatted descriptions are stored, the default description for the
+    // error code is looked up when it is read
+    if (format)
+    {
+        va_list vl;
+
+        va_start(vl, format);
+        vsnprintf(error->description, sizeof(error->description), format, vl);
+        va_end(vl);
+
+        error->description[sizeof(error->description) - 1] = '\0';
+    }
+    else
+        error->description[0] = '\0';
 
     if (_glfwErrorCallback)
-        _glfwErrorCallback(code, description);
+        _glfwErrorCallback(code, getErrorDescription(error));
 }
 
 
@@ -402,14 +476,16 @@ GLFWAPI int glfwInit(void)
     if (!_glfwSelectPlatform(_glfw.hints.init.platformID, &_glfw.platform))
         return GLFW_FALSE;
 
+    // The platform may create wait timers on the clock of the GLFW timer
+    _glfwPlatformInitTimer();
+
     if (!_glfw.platform.init())
     {
         terminate();
         return GLFW_FALSE;
     }
 
-    if (!_glfwPlatformCreateMutex(&_glfw.errorLock) ||
-        !_glfwPlatformCreateTls(&_glfw.errorSlot) ||
+    if (!_glfwPlatformCreateTls(&_glfw.errorSlot) ||
         !_glfwPlatformCreateTls(&_glfw.contextSlot))
     {
         terminate();
@@ -418,11 +494,7 @@ GLFWAPI int glfwInit(void)
 
     _glfwPlatformSetTls(&_glfw.errorSlot, &_glfwMainThreadError);
 
-    _glfwInitGamepadMappings();
-
-    _glfwPlatformInitTimer();
     _glfw.timer.offset = _glfwPlatformGetTimerValue();
-
     _glfw.initialized = GLFW_TRUE;
 
     glfwDefaultWindowHints();
@@ -459,6 +531,12 @@ GLFWAPI void glfwInitHint(int hint, int value)
         case GLFW_X11_XCB_VULKAN_SURFACE:
             _glfwInitHints.x11.xcbVulkanSurface = value;
             return;
+        case GLFW_X11_EVENT_BUDGET:
+            _glfwInitHints.x11.eventBudget = value;
+            return;
+        case GLFW_X11_EVENT_TIME_BUDGET:
+            _glfwInitHints.x11.eventTimeBudget = value;
+            return;
         case GLFW_WAYLAND_LIBDECOR:
             _glfwInitHints.wl.libdecorMode = value;
             return;
@@ -512,9 +590,9 @@ GLFWAPI int glfwGetError(const char** description)
     if (error)
     {
         code = error->code;
-        error->code = GLFW_NO_ERROR;
         if (description && code)
-            *description = error->description;
+            *description = getErrorDescription(error);
+        error->code = GLFW_NO_ERROR;
     }
 
     return code;
@@ -526,3 +604,16 @@ GLFWAPI GLFWerrorfun glfwSetErrorCallback(GLFWerrorfun cbfun)
     return cbfun;
 }
 
+
+GLFWAPI uint64_t glfwGetCounter(int counter)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (counter < GLFW_SELECTION_REQUESTS || counter > _GLFW_COUNTER_LAST)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, "Invalid counter 0x%08X", counter);
+        return 0;
+    }
+
+    return readCounter(counter);
+}
@@ -26,7 +26,6 @@
 //========================================================================
 
 #include "internal.h"
-#include "mappings.h"
 
 #include <assert.h>
 #include <float.h>
@@ -42,6 +41,13 @@
 #define _GLFW_JOYSTICK_BUTTON   2
 #define _GLFW_JOYSTICK_HATBIT   3
 
+// The pre-parsed mapping table uses the above constants
+#if defined(_GLFW_MAPPING_TABLE)
+ #include "mapping_table.h"
+#else
+ #include "mappings.h"
+#endif
+
 #define GLFW_MOD_MASK (GLFW_MOD_SHIFT | \
                        GLFW_MOD_CONTROL | \
                        GLFW_MOD_ALT | \
@@ -65,62 +71,113 @@ static GLFWbool initJoysticks(void)
     return _glfw.joysticksInitialized = GLFW_TRUE;
 }
 
-// Finds a mapping based on joystick GUID
+// Returns the FNV-1a hash of a joystick GUID
 //
-static _GLFWmapping* findMapping(const char* guid)
+static uint32_t hashGUID(const char* guid)
 {
-    int i;
+    uint32_t hash = 2166136261u;
 
-    for (i = 0;  i < _glfw.mappingCount;  i++)
+    while (*guid)
     {
-        if (strcmp(_glfw.mappings[i].guid, guid) == 0)
-            return _glfw.mappings + i;
+        hash ^= (unsigned char) *guid++;
+        hash *= 16777619u;
     }
 
-    return NULL;
+    return hash;
 }
 
-// Checks whether a gamepad mapping element is present in the hardware
+// Returns the mapping index slot for the specified GUID
+// The slot is either empty or holds the first mapping with that GUID
 //
-static GLFWbool isValidElementForJoystick(const _GLFWmapelement* e,
-                                          const _GLFWjoystick* js)
+static int* findMappingSlot(const char* guid)
 {
-    if (e->type == _GLFW_JOYSTICK_HATBIT && (e->index >> 4) >= js->hatCount)
-        return GLFW_FALSE;
-    else if (e->type == _GLFW_JOYSTICK_BUTTON && e->index >= js->buttonCount)
-        return GLFW_FALSE;
-    else if (e->type == _GLFW_JOYSTICK_AXIS && e->index >= js->axisCount)
-        return GLFW_FALSE;
+    const int mask = _glfw.mappingIndexSize - 1;
+    int i = (int) (hashGUID(guid) & (uint32_t) mask);
 
-    return GLFW_TRUE;
+    for (;;)
+    {
+        int* slot = _glfw.mappingIndex + i;
+        if (*slot == 0 || strcmp(_glfw.mappings[*slot - 1].guid, guid) == 0)
+            return slot;
+
+        i = (i + 1) & mask;
+    }
 }
 
-// Finds a mapping based on joystick GUID and verifies element indices
+// Adds the specified mapping to the GUID index unless its GUID is already there
+// The mapping is not indexed if the index could not be grown to fit it
 //
-static _GLFWmapping* findValidMapping(const _GLFWjoystick* js)
+static GLFWbool indexMapping(int index)
 {
-    _GLFWmapping* mapping = findMapping(js->guid);
-    if (mapping)
+    int* slot;
+
+    // Keep the load factor at or below one half
+    if ((_glfw.mappingCount + 1) * 2 > _glfw.mappingIndexSize)
     {
-        int i;
+        int i, size = _glfw.mappingIndexSize ? _glfw.mappingIndexSize : 64;
+        int* previous = _glfw.mappingIndex;
+        const int previousSize = _glfw.mappingIndexSize;
 
-        for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
+        while ((_glfw.mappingCount + 1) * 2 > size)
+            size *= 2;
+
+        _glfw.mappingIndex = _glfw_calloc(size, sizeof(int));
+        if (!_glfw.mappingIndex)
         {
-            if (!isValidElementForJoystick(mapping->buttons + i, js))
-                return NULL;
+            _glfw.mappingIndex = previous;
+            return GLFW_FALSE;
         }
 
-        for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+        _glfw.mappingIndexSize = size;
+
+        for (i = 0;  i < previousSize;  i++)
         {
-            if (!isValidElementForJoystick(mapping->axes + i, js))
-                return NULL;
+            if (previous[i])
+                *findMappingSlot(_glfw.mappings[previous[i] - 1].guid) = previous[i];
         }
+
+        _glfw_free(previous);
     }
 
-    return mapping;
+    slot = findMappingSlot(_glfw.mappings[index].guid);
+    if (*slot == 0)
+        *slot = index + 1;
+
+    return GLFW_TRUE;
 }
 
-// Parses an SDL_GameControllerDB line and adds it to the mapping list
+// Finds a mapping based on joystick GUID
+//
+static _GLFWmapping* findMapping(const char* guid)
+{
+    int slot;
+
+    if (!_glfw.mappingIndexSize)
+        return NULL;
+
+    slot = *findMappingSlot(guid);
+    if (slot)
+        return _glfw.mappings + slot - 1;
+
+    return NULL;
+}
+
+// Converts a mapping GUID to the form used by the platform for joysticks
+//
+static void normalizeGUID(char* guid)
+{
+    int i;
+
+    for (i = 0;  i < 32;  i++)
+    {
+        if (guid[i] >= 'A' && guid[i] <= 'F')
+            guid[i] += 'a' - 'A';
+    }
+
+    _glfw.platform.updateGamepadGUID(guid);
+}
+
+// Parses an SDL_GameControllerDB line into the specified mapping
 //
 static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
 {
@@ -252,16 +309,393 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
         c += strspn(c, ",");
     }
 
-    for (i = 0;  i < 32;  i++)
+    normalizeGUID(mapping->guid);
+    return GLFW_TRUE;
+}
+
+// Appends a copy of the specified mapping to the mapping list
+//
+static _GLFWmapping* addMapping(const _GLFWmapping* mapping)
+{
+    if (_glfw.mappingCount == _glfw.mappingCapacity)
+    {
+        int jid, offsets[GLFW_JOYSTICK_LAST + 1];
+        const int capacity = _glfw_max(_glfw.mappingCapacity * 2, 64);
+        _GLFWmapping* mappings;
+
+        // Mappings are added while joysticks are connected, so any mapping
+        // pointers held by joysticks have to survive the list moving
+        for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+        {
+            const _GLFWjoystick* js = _glfw.joysticks + jid;
+            if (js->mapping)
+                offsets[jid] = (int) (js->mapping - _glfw.mappings);
+            else
+                offsets[jid] = -1;
+        }
+
+        mappings = _glfw_realloc(_glfw.mappings, sizeof(_GLFWmapping) * capacity);
+        if (!mappings)
+            return NULL;
+
+        _glfw.mappings = mappings;
+        _glfw.mappingCapacity = capacity;
+
+        for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+        {
+            if (offsets[jid] != -1)
+                _glfw.joysticks[jid].mapping = _glfw.mappings + offsets[jid];
+        }
+    }
+
+    _glfw.mappings[_glfw.mappingCount] = *mapping;
+    if (!indexMapping(_glfw.mappingCount))
+        return NULL;
+
+    return _glfw.mappings + _glfw.mappingCount++;
+}
+
+#if defined(_GLFW_MAPPING_TABLE)
+
+// Adds the first valid built-in mapping for the specified GUID, if any, to the
+// mapping list
+//
+static _GLFWmapping* loadDefaultMapping(const char* guid)
+{
+    // The last entry of the table is an empty terminator
+    const size_t count = sizeof(_glfwDefaultMappingTable) / sizeof(_GLFWmapping) - 1;
+    size_t first = 0, last = count;
+
+    // The table is sorted by GUID and equal GUIDs keep their original order
+    while (first < last)
+    {
+        const size_t middle = first + (last - first) / 2;
+        if (strcmp(_glfwDefaultMappingTable[middle].guid, guid) < 0)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    if (first < count && strcmp(_glfwDefaultMappingTable[first].guid, guid) == 0)
+        return addMapping(_glfwDefaultMappingTable + first);
+
+    return NULL;
+}
+
+#else
+
+// Returns the normalized GUID of every built-in mapping string
+// Entries without a valid GUID are left empty
+//
+static const char* getDefaultMappingGUIDs(void)
+{
+    if (!_glfw.defaultMappingGUIDs)
+    {
+        size_t i;
+        const size_t count = sizeof(_glfwDefaultMappings) / sizeof(char*);
+
+        char* guids = _glfw_calloc(count, 33);
+        if (!guids)
+            return NULL;
+
+        for (i = 0;  i < count;  i++)
+        {
+            if (strcspn(_glfwDefaultMappings[i], ",") != 32)
+                continue;
+
+            memcpy(guids + i * 33, _glfwDefaultMappings[i], 32);
+            normalizeGUID(guids + i * 33);
+        }
+
+        _glfw.defaultMappingGUIDs = guids;
+    }
+
+    return _glfw.defaultMappingGUIDs;
+}
+
+// Parses the first valid built-in mapping for the specified GUID, if any, and
+// adds it to the mapping list
+//
+static _GLFWmapping* loadDefaultMapping(const char* guid)
+{
+    size_t i;
+    const size_t count = sizeof(_glfwDefaultMappings) / sizeof(char*);
+
+    // Compare GUIDs before doing the more expensive full parsing
+    const char* guids = getDefaultMappingGUIDs();
+    if (!guids)
+        return NULL;
+
+    for (i = 0;  i < count;  i++)
     {
-        if (mapping->guid[i] >= 'A' && mapping->guid[i] <= 'F')
-            mapping->guid[i] += 'a' - 'A';
+        _GLFWmapping mapping = {{0}};
+
+        if (strcmp(guids + i * 33, guid) != 0)
+            continue;
+
+        if (parseMapping(&mapping, _glfwDefaultMappings[i]))
+            return addMapping(&mapping);
     }
 
-    _glfw.platform.updateGamepadGUID(mapping->guid);
+    return NULL;
+}
+
+#endif // _GLFW_MAPPING_TABLE
+
+// Checks whether a gamepad mapping element is present in the hardware
+//
+static GLFWbool isValidElementForJoystick(const _GLFWmapelement* e,
+                                          const _GLFWjoystick* js)
+{
+    if (e->type == _GLFW_JOYSTICK_HATBIT && (e->index >> 4) >= js->hatCount)
+        return GLFW_FALSE;
+    else if (e->type == _GLFW_JOYSTICK_BUTTON && e->index >= js->buttonCount)
+        return GLFW_FALSE;
+    else if (e->type == _GLFW_JOYSTICK_AXIS && e->index >= js->axisCount)
+        return GLFW_FALSE;
+
     return GLFW_TRUE;
 }
 
+// Finds a mapping based on joystick GUID and verifies element indices
+//
+static _GLFWmapping* findValidMapping(const _GLFWjoystick* js)
+{
+    _GLFWmapping* mapping = findMapping(js->guid);
+    if (!mapping)
+        mapping = loadDefaultMapping(js->guid);
+
+    if (mapping)
+    {
+        int i;
+
+        for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
+        {
+            if (!isValidElementForJoystick(mapping->buttons + i, js))
+                return NULL;
+        }
+
+        for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+        {
+            if (!isValidElementForJoystick(mapping->axes + i, js))
+                return NULL;
+        }
+    }
+
+    return mapping;
+}
+
+// Resolves a gamepad mapping element into a transform
+//
+static void setTransform(_GLFWtransform* t, const _GLFWmapelement* e,
+                         GLFWbool button)
+{
+    memset(t, 0, sizeof(_GLFWtransform));
+    t->type = e->type;
+
+    if (e->type == _GLFW_JOYSTICK_AXIS)
+    {
+        t->index = e->index;
+        t->scale = e->axisScale;
+        t->offset = e->axisOffset;
+
+        // Flip the transform of buttons that are pressed on the negative side
+        // so that every button is pressed when its value is not negative
+        if (button &&
+            !(e->axisOffset < 0 || (e->axisOffset == 0 && e->axisScale > 0)))
+        {
+            t->scale = -t->scale;
+            t->offset = -t->offset;
+        }
+    }
+    else if (e->type == _GLFW_JOYSTICK_BUTTON || e->type == _GLFW_JOYSTICK_HATBIT)
+    {
+        if (e->type == _GLFW_JOYSTICK_HATBIT)
+        {
+            t->index = e->index >> 4;
+            t->bit = e->index & 0xf;
+        }
+        else
+            t->index = e->index;
+
+        // The source value is either zero or one
+        if (button)
+        {
+            t->scale = 1.f;
+            t->offset = -0.5f;
+        }
+        else
+        {
+            t->scale = 2.f;
+            t->offset = -1.f;
+        }
+    }
+    else if (button)
+        t->offset = -1.f;
+}
+
+// Finds the gamepad mapping of the joystick and precomputes its transforms
+//
+static void updateGamepadMapping(_GLFWjoystick* js)
+{
+    int i;
+
+    js->mapping = findValidMapping(js);
+    if (!js->mapping)
+        return;
+
+    for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
+        setTransform(js->buttonTransforms + i, js->mapping->buttons + i, GLFW_TRUE);
+
+    for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+        setTransform(js->axisTransforms + i, js->mapping->axes + i, GLFW_FALSE);
+}
+
+// Applies a gamepad element transform to the current joystick state
+//
+static float applyTransform(const _GLFWtransform* t, const _GLFWjoystick* js)
+{
+    float value;
+
+    switch (t->type)
+    {
+        case _GLFW_JOYSTICK_AXIS:
+            value = js->axes[t->index];
+            break;
+        case _GLFW_JOYSTICK_BUTTON:
+            value = js->buttons[t->index];
+            break;
+        case _GLFW_JOYSTICK_HATBIT:
+            value = (js->hats[t->index] & t->bit) ? 1.f : 0.f;
+            break;
+        default:
+            value = 0.f;
+            break;
+    }
+
+    return value * t->scale + t->offset;
+}
+
+// Computes the gamepad state of a polled joystick with a gamepad mapping
+//
+static void getGamepadState(const _GLFWjoystick* js, GLFWgamepadstate* state)
+{
+    int i;
+
+    for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
+    {
+        const float value = applyTransform(js->buttonTransforms + i, js);
+        state->buttons[i] = value >= 0.f ? GLFW_PRESS : GLFW_RELEASE;
+    }
+
+    for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+    {
+        const float value = applyTransform(js->axisTransforms + i, js);
+        state->axes[i] = fminf(fmaxf(value, -1.f), 1.f);
+    }
+}
+
+
+
+// Returns the time of the platform event being processed
+// Events without a platform timestamp are stamped with the current time
+//
+static uint64_t getEventTime(void)
+{
+    if (_glfw.eventTime.current)
+        return _glfw.eventTime.current;
+
+    return _glfwPlatformGetTimerValue();
+}
+
+// Appends a cleared event record to the event queue of the specified window
+// The oldest event is discarded if the queue is full
+//
+static GLFWevent* queueEvent(_GLFWwindow* window, int type)
+{
+    GLFWevent* event;
+
+    if (window->queue.count == _GLFW_EVENT_QUEUE_SIZE)
+    {
+        window->queue.head = (window->queue.head + 1) % _GLFW_EVENT_QUEUE_SIZE;
+        window->queue.count--;
+    }
+
+    event = window->queue.events +
+        (window->queue.head + window->queue.count) % _GLFW_EVENT_QUEUE_SIZE;
+    window->queue.count++;
+
+    memset(event, 0, sizeof(GLFWevent));
+    event->type = type;
+    event->time = getEventTime();
+    return event;
+}
+
+// Appends a cursor position to the motion history of the specified window
+// The last record is replaced if the history is full, so it always ends with
+// the final position
+//
+static void recordCursorPos(_GLFWwindow* window, double xpos, double ypos)
+{
+    GLFWevent* event;
+
+    if (window->motion.count < _GLFW_CURSOR_HISTORY_SIZE)
+        window->motion.count++;
+
+    event = window->motion.history + window->motion.count - 1;
+    memset(event, 0, sizeof(GLFWevent));
+    event->type = GLFW_EVENT_CURSOR_POS;
+    event->x = xpos;
+    event->y = ypos;
+    event->time = getEventTime();
+}
+
+// Passes a cursor position to the event queue or the cursor position callback
+//
+static void reportCursorPos(_GLFWwindow* window, double xpos, double ypos)
+{
+    if (window->queue.events)
+    {
+        GLFWevent* event = queueEvent(window, GLFW_EVENT_CURSOR_POS);
+        event->x = xpos;
+        event->y = ypos;
+        return;
+    }
+
+    if (window->callbacks.cursorPos)
+        window->callbacks.cursorPos((GLFWwindow*) window, xpos, ypos);
+}
+
+// Reports the final position of the coalesced cursor motion of the specified
+// window, if any, with the time of the last merged motion
+//
+static void flushCursorMotion(_GLFWwindow* window)
+{
+    const uint64_t time = _glfw.eventTime.current;
+
+    if (!window->motion.pending)
+        return;
+
+    window->motion.pending = GLFW_FALSE;
+
+    _glfwInputEventTime(window->motion.time);
+    reportCursorPos(window,
+                    window->virtualCursorPosX,
+                    window->virtualCursorPosY);
+    _glfwInputEventTime(time);
+}
+
+// Frees the specified clipboard items
+//
+static void freeClipboardItems(GLFWclipboarditem* items, const char** types, int count)
+{
+    for (int i = 0;  i < count;  i++)
+        _glfw_free((void*) items[i].data);
+
+    _glfw_free(items);
+    _glfw_free(types);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
@@ -299,6 +733,16 @@ void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int m
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
+    if (window->queue.events)
+    {
+        GLFWevent* event = queueEvent(window, GLFW_EVENT_KEY);
+        event->code = key;
+        event->scancode = scancode;
+        event->action = action;
+        event->mods = mods;
+        return;
+    }
+
     if (window->callbacks.key)
         window->callbacks.key((GLFWwindow*) window, key, scancode, action, mods);
 }
@@ -318,6 +762,18 @@ void _glfwInputChar(_GLFWwindow* window, uint32_t codepoint, int mods, GLFWbool
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
+    if (window->queue.events)
+    {
+        if (plain)
+        {
+            GLFWevent* event = queueEvent(window, GLFW_EVENT_CHAR);
+            event->code = (int) codepoint;
+            event->mods = mods;
+        }
+
+        return;
+    }
+
     if (window->callbacks.charmods)
         window->callbacks.charmods((GLFWwindow*) window, codepoint, mods);
 
@@ -338,6 +794,14 @@ void _glfwInputScroll(_GLFWwindow* window, double xoffset, double yoffset)
     assert(yoffset > -FLT_MAX);
     assert(yoffset < FLT_MAX);
 
+    if (window->queue.events)
+    {
+        GLFWevent* event = queueEvent(window, GLFW_EVENT_SCROLL);
+        event->x = xoffset;
+        event->y = yoffset;
+        return;
+    }
+
     if (window->callbacks.scroll)
         window->callbacks.scroll((GLFWwindow*) window, xoffset, yoffset);
 }
@@ -357,6 +821,9 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
+    // The click happened where the cursor was moved to before it
+    flushCursorMotion(window);
+
     if (button <= GLFW_MOUSE_BUTTON_LAST)
     {
         if (action == GLFW_RELEASE && window->stickyMouseButtons)
@@ -365,6 +832,15 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
             window->mouseButtons[button] = (char) action;
     }
 
+    if (window->queue.events)
+    {
+        GLFWevent* event = queueEvent(window, GLFW_EVENT_MOUSE_BUTTON);
+        event->code = button;
+        event->action = action;
+        event->mods = mods;
+        return;
+    }
+
     if (window->callbacks.mouseButton)
         window->callbacks.mouseButton((GLFWwindow*) window, button, action, mods);
 }
@@ -383,11 +859,24 @@ void _glfwInputCursorPos(_GLFWwindow* window, double xpos, double ypos)
     if (window->virtualCursorPosX == xpos && window->virtualCursorPosY == ypos)
         return;
 
+    if (window->motion.coalesce)
+    {
+        window->motion.xdelta += xpos - window->virtualCursorPosX;
+        window->motion.ydelta += ypos - window->virtualCursorPosY;
+        window->motion.time = getEventTime();
+        window->motion.pending = GLFW_TRUE;
+
+        if (window->motion.history)
+            recordCursorPos(window, xpos, ypos);
+    }
+
     window->virtualCursorPosX = xpos;
     window->virtualCursorPosY = ypos;
 
-    if (window->callbacks.cursorPos)
-        window->callbacks.cursorPos((GLFWwindow*) window, xpos, ypos);
+    if (window->motion.coalesce)
+        return;
+
+    reportCursorPos(window, xpos, ypos);
 }
 
 // Notifies shared code of a cursor enter/leave event
@@ -397,6 +886,16 @@ void _glfwInputCursorEnter(_GLFWwindow* window, GLFWbool entered)
     assert(window != NULL);
     assert(entered == GLFW_TRUE || entered == GLFW_FALSE);
 
+    // Motion that arrived before the crossing is reported before it
+    flushCursorMotion(window);
+
+    if (window->queue.events)
+    {
+        GLFWevent* event = queueEvent(window, GLFW_EVENT_CURSOR_ENTER);
+        event->code = entered;
+        return;
+    }
+
     if (window->callbacks.cursorEnter)
         window->callbacks.cursorEnter((GLFWwindow*) window, entered);
 }
@@ -437,6 +936,9 @@ void _glfwInputJoystickAxis(_GLFWjoystick* js, int axis, float value)
     assert(axis >= 0);
     assert(axis < js->axisCount);
 
+    if (js->axes[axis] != value)
+        js->eventTime = getEventTime();
+
     js->axes[axis] = value;
 }
 
@@ -449,6 +951,9 @@ void _glfwInputJoystickButton(_GLFWjoystick* js, int button, char value)
     assert(button < js->buttonCount);
     assert(value == GLFW_PRESS || value == GLFW_RELEASE);
 
+    if (js->buttons[button] != value)
+        js->eventTime = getEventTime();
+
     js->buttons[button] = value;
 }
 
@@ -468,6 +973,9 @@ void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value)
     assert((value & GLFW_HAT_LEFT) == 0 || (value & GLFW_HAT_RIGHT) == 0);
     assert((value & GLFW_HAT_UP) == 0 || (value & GLFW_HAT_DOWN) == 0);
 
+    if (js->hats[hat] != value)
+        js->eventTime = getEventTime();
+
     base = js->buttonCount + hat * 4;
 
     js->buttons[base + 0] = (value & 0x01) ? GLFW_PRESS : GLFW_RELEASE;
@@ -475,83 +983,257 @@ void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value)
     js->buttons[base + 2] = (value & 0x04) ? GLFW_PRESS : GLFW_RELEASE;
     js->buttons[base + 3] = (value & 0x08) ? GLFW_PRESS : GLFW_RELEASE;
 
-    js->hats[hat] = value;
+    js->hats[hat] = value;
+}
+
+// Notifies shared code of the time at which the platform event being
+// processed was generated, in the time base of the timer
+// Platform code passes zero once it is done with the event
+//
+void _glfwInputEventTime(uint64_t time)
+{
+    _glfw.eventTime.current = time;
+}
+
+// Notifies shared code that a requested clipboard string has been received
+// The string is NULL if the clipboard could not be converted
+//
+void _glfwInputClipboardString(const char* string)
+{
+    GLFWclipboardfun callback = _glfw.callbacks.clipboard;
+    _glfw.callbacks.clipboard = NULL;
+
+    if (callback)
+        callback(string);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Returns an available joystick object with arrays and name allocated
+//
+_GLFWjoystick* _glfwAllocJoystick(const char* name,
+                                  const char* guid,
+                                  int axisCount,
+                                  int buttonCount,
+                                  int hatCount)
+{
+    int jid;
+    _GLFWjoystick* js;
+
+    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    {
+        if (!_glfw.joysticks[jid].allocated)
+            break;
+    }
+
+    if (jid > GLFW_JOYSTICK_LAST)
+        return NULL;
+
+    js = _glfw.joysticks + jid;
+    js->allocated   = GLFW_TRUE;
+    js->axes        = _glfw_calloc(axisCount, sizeof(float));
+    js->buttons     = _glfw_calloc(buttonCount + (size_t) hatCount * 4, 1);
+    js->hats        = _glfw_calloc(hatCount, 1);
+    js->axisCount   = axisCount;
+    js->buttonCount = buttonCount;
+    js->hatCount    = hatCount;
+
+    strncpy(js->name, name, sizeof(js->name) - 1);
+    strncpy(js->guid, guid, sizeof(js->guid) - 1);
+    updateGamepadMapping(js);
+
+    return js;
+}
+
+// Frees arrays and name and flags the joystick object as unused
+//
+void _glfwFreeJoystick(_GLFWjoystick* js)
+{
+    _glfw_free(js->axes);
+    _glfw_free(js->buttons);
+    _glfw_free(js->hats);
+    memset(js, 0, sizeof(_GLFWjoystick));
+}
+
+// Center the cursor in the content area of the specified window
+//
+void _glfwCenterCursorInContentArea(_GLFWwindow* window)
+{
+    int width, height;
+
+    _glfw.platform.getWindowSize(window, &width, &height);
+    _glfw.platform.setCursorPos(window, width / 2.0, height / 2.0);
+}
+
+// Converts a millisecond timestamp of the window system event clock to the time
+// base of the timer
+// The offset between the clocks is estimated from the smallest observed delay
+// between the event timestamp and its processing, so converted times are never
+// later than the time at which the event was processed
+//
+uint64_t _glfwConvertEventTime(uint32_t milliseconds)
+{
+    const int64_t now = (int64_t) _glfwPlatformGetTimerValue();
+    const int64_t frequency = (int64_t) _glfwPlatformGetTimerFrequency();
+    int64_t ticks, offset;
+
+    // Extend the wrapping 32-bit timestamp to 64 bits
+    if (_glfw.eventTime.synced)
+        _glfw.eventTime.milliseconds += (int32_t) (milliseconds - _glfw.eventTime.last);
+    else
+        _glfw.eventTime.milliseconds = milliseconds;
+
+    _glfw.eventTime.last = milliseconds;
+
+    ticks = (_glfw.eventTime.milliseconds / 1000) * frequency +
+            (_glfw.eventTime.milliseconds % 1000) * frequency / 1000;
+
+    offset = now - ticks;
+    if (!_glfw.eventTime.synced || offset < _glfw.eventTime.offset)
+    {
+        _glfw.eventTime.offset = offset;
+        _glfw.eventTime.synced = GLFW_TRUE;
+    }
+
+    return (uint64_t) (ticks + _glfw.eventTime.offset);
+}
+
+// Converts a microsecond timestamp of a window system clock with an unspecified
+// base to the time base of the timer
+// The offset is estimated as for millisecond timestamps but kept separately, as
+// the two clocks need not have the same base
+//
+uint64_t _glfwConvertEventTimeMicroseconds(uint64_t microseconds)
+{
+    const int64_t now = (int64_t) _glfwPlatformGetTimerValue();
+    const int64_t frequency = (int64_t) _glfwPlatformGetTimerFrequency();
+    int64_t ticks, offset;
+
+    ticks = (int64_t) (microseconds / 1000000) * frequency +
+            (int64_t) (microseconds % 1000000) * frequency / 1000000;
+
+    offset = now - ticks;
+    if (!_glfw.eventTime.microsecondsSynced ||
+        offset < _glfw.eventTime.microsecondsOffset)
+    {
+        _glfw.eventTime.microsecondsOffset = offset;
+        _glfw.eventTime.microsecondsSynced = GLFW_TRUE;
+    }
+
+    return (uint64_t) (ticks + _glfw.eventTime.microsecondsOffset);
+}
+
+// Returns the timer value the specified number of seconds from now, saturating
+// instead of wrapping for very long timeouts
+//
+uint64_t _glfwGetDeadline(double timeout)
+{
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    const double ticks = timeout * (double) _glfwPlatformGetTimerFrequency();
+
+    if (ticks >= (double) (UINT64_MAX - now))
+        return UINT64_MAX;
+
+    return now + (uint64_t) ticks;
 }
 
+// Returns the number of seconds until the timer reaches the specified value,
+// or zero if it already has
+//
+double _glfwGetTimeoutUntil(uint64_t deadline)
+{
+    const uint64_t now = _glfwPlatformGetTimerValue();
 
-//////////////////////////////////////////////////////////////////////////
-//////                       GLFW internal API                      //////
-//////////////////////////////////////////////////////////////////////////
+    if (deadline <= now)
+        return 0.0;
+
+    return (double) (deadline - now) / (double) _glfwPlatformGetTimerFrequency();
+}
 
-// Adds the built-in set of gamepad mappings
+// Starts an event processing pass
+// Windows without pending cursor motion start accumulating it anew
 //
-void _glfwInitGamepadMappings(void)
+void _glfwBeginEventProcessing(void)
 {
-    size_t i;
-    const size_t count = sizeof(_glfwDefaultMappings) / sizeof(char*);
-    _glfw.mappings = _glfw_calloc(count, sizeof(_GLFWmapping));
+    _GLFWwindow* window;
 
-    for (i = 0;  i < count;  i++)
+    for (window = _glfw.windowListHead;  window;  window = window->next)
     {
-        if (parseMapping(&_glfw.mappings[_glfw.mappingCount], _glfwDefaultMappings[i]))
-            _glfw.mappingCount++;
+        if (window->motion.pending)
+            continue;
+
+        window->motion.xdelta = 0.0;
+        window->motion.ydelta = 0.0;
+        window->motion.count = 0;
     }
 }
 
-// Returns an available joystick object with arrays and name allocated
+// Finishes an event processing pass
+// The final position of the coalesced cursor motion of each window is reported
 //
-_GLFWjoystick* _glfwAllocJoystick(const char* name,
-                                  const char* guid,
-                                  int axisCount,
-                                  int buttonCount,
-                                  int hatCount)
+void _glfwEndEventProcessing(void)
 {
-    int jid;
-    _GLFWjoystick* js;
+    _GLFWwindow* window = _glfw.windowListHead;
 
-    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    while (window)
     {
-        if (!_glfw.joysticks[jid].allocated)
-            break;
-    }
-
-    if (jid > GLFW_JOYSTICK_LAST)
-        return NULL;
+        if (!window->motion.pending)
+        {
+            window = window->next;
+            continue;
+        }
 
-    js = _glfw.joysticks + jid;
-    js->allocated   = GLFW_TRUE;
-    js->axes        = _glfw_calloc(axisCount, sizeof(float));
-    js->buttons     = _glfw_calloc(buttonCount + (size_t) hatCount * 4, 1);
-    js->hats        = _glfw_calloc(hatCount, 1);
-    js->axisCount   = axisCount;
-    js->buttonCount = buttonCount;
-    js->hatCount    = hatCount;
+        flushCursorMotion(window);
 
-    strncpy(js->name, name, sizeof(js->name) - 1);
-    strncpy(js->guid, guid, sizeof(js->guid) - 1);
-    js->mapping = findValidMapping(js);
+        // The callback may have destroyed any window, so start over
+        window = _glfw.windowListHead;
+    }
+}
 
-    return js;
+// Frees the clipboard items set with glfwSetClipboardData, if any
+// The platform may still refer to the items until its clipboard is replaced
+//
+void _glfwFreeClipboardItems(void)
+{
+    freeClipboardItems(_glfw.clipboard.items,
+                       _glfw.clipboard.types,
+                       _glfw.clipboard.count);
+    memset(&_glfw.clipboard, 0, sizeof(_glfw.clipboard));
 }
 
-// Frees arrays and name and flags the joystick object as unused
+// Returns the clipboard item of the specified type, if any
 //
-void _glfwFreeJoystick(_GLFWjoystick* js)
+const GLFWclipboarditem* _glfwFindClipboardItem(const char* type)
 {
-    _glfw_free(js->axes);
-    _glfw_free(js->buttons);
-    _glfw_free(js->hats);
-    memset(js, 0, sizeof(_GLFWjoystick));
+    for (int i = 0;  i < _glfw.clipboard.count;  i++)
+    {
+        if (strcmp(_glfw.clipboard.items[i].type, type) == 0)
+            return _glfw.clipboard.items + i;
+    }
+
+    return NULL;
 }
 
-// Center the cursor in the content area of the specified window
+// Returns a null-terminated copy of the UTF-8 text clipboard item, if any
 //
-void _glfwCenterCursorInContentArea(_GLFWwindow* window)
+char* _glfwCopyClipboardItemString(void)
 {
-    int width, height;
+    const GLFWclipboarditem* item =
+        _glfwFindClipboardItem("text/plain;charset=utf-8");
+    if (!item)
+        return NULL;
 
-    _glfw.platform.getWindowSize(window, &width, &height);
-    _glfw.platform.setCursorPos(window, width / 2.0, height / 2.0);
+    char* string = _glfw_calloc(item->size + 1, 1);
+    if (!string)
+        return NULL;
+
+    if (item->size)
+        memcpy(string, item->data, item->size);
+
+    return string;
 }
 
 
@@ -580,6 +1262,12 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* handle, int mode)
             return window->rawMouseMotion;
         case GLFW_UNLIMITED_MOUSE_BUTTONS:
             return window->disableMouseButtonLimit;
+        case GLFW_EVENT_QUEUE:
+            return window->queue.events != NULL;
+        case GLFW_COALESCE_CURSOR_MOTION:
+            return window->motion.coalesce;
+        case GLFW_CURSOR_MOTION_HISTORY:
+            return window->motion.history != NULL;
     }
 
     _glfwInputError(GLFW_INVALID_ENUM, "Invalid input mode 0x%08X", mode);
@@ -693,6 +1381,55 @@ GLFWAPI void glfwSetInputMode(GLFWwindow* handle, int mode, int value)
             window->disableMouseButtonLimit = value ? GLFW_TRUE : GLFW_FALSE;
             return;
         }
+
+        case GLFW_EVENT_QUEUE:
+        {
+            if (value)
+            {
+                if (!window->queue.events)
+                {
+                    window->queue.events =
+                        _glfw_calloc(_GLFW_EVENT_QUEUE_SIZE, sizeof(GLFWevent));
+                }
+            }
+            else
+            {
+                _glfw_free(window->queue.events);
+                memset(&window->queue, 0, sizeof(window->queue));
+            }
+
+            return;
+        }
+
+        case GLFW_COALESCE_CURSOR_MOTION:
+        {
+            // Motion merged so far is reported before any that is not merged
+            if (!value)
+                flushCursorMotion(window);
+
+            window->motion.coalesce = value ? GLFW_TRUE : GLFW_FALSE;
+            return;
+        }
+
+        case GLFW_CURSOR_MOTION_HISTORY:
+        {
+            if (value)
+            {
+                if (!window->motion.history)
+                {
+                    window->motion.history =
+                        _glfw_calloc(_GLFW_CURSOR_HISTORY_SIZE, sizeof(GLFWevent));
+                }
+            }
+            else
+            {
+                _glfw_free(window->motion.history);
+                window->motion.history = NULL;
+                window->motion.count = 0;
+            }
+
+            return;
+        }
     }
 
     _glfwInputError(GLFW_INVALID_ENUM, "Invalid input mode 0x%08X", mode);
@@ -811,6 +1548,42 @@ GLFWAPI void glfwGetCursorPos(GLFWwindow* handle, double* xpos, double* ypos)
         _glfw.platform.getCursorPos(window, xpos, ypos);
 }
 
+GLFWAPI void glfwGetCursorMotion(GLFWwindow* handle, double* xdelta, double* ydelta)
+{
+    if (xdelta)
+        *xdelta = 0;
+    if (ydelta)
+        *ydelta = 0;
+
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (xdelta)
+        *xdelta = window->motion.xdelta;
+    if (ydelta)
+        *ydelta = window->motion.ydelta;
+}
+
+GLFWAPI const GLFWevent* glfwGetCursorHistory(GLFWwindow* handle, int* count)
+{
+    assert(count != NULL);
+
+    *count = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (!window->motion.history)
+        return NULL;
+
+    *count = window->motion.count;
+    return window->motion.history;
+}
+
 GLFWAPI void glfwSetCursorPos(GLFWwindow* handle, double xpos, double ypos)
 {
     _GLFW_REQUIRE_INIT();
@@ -1045,6 +1818,36 @@ GLFWAPI GLFWdropfun glfwSetDropCallback(GLFWwindow* handle, GLFWdropfun cbfun)
     return cbfun;
 }
 
+GLFWAPI int glfwGetEvents(GLFWwindow* handle, GLFWevent* events, int count)
+{
+    int i;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(events != NULL);
+    assert(count >= 0);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid event count %i", count);
+        return 0;
+    }
+
+    if (count > window->queue.count)
+        count = window->queue.count;
+
+    for (i = 0;  i < count;  i++)
+    {
+        events[i] = window->queue.events[window->queue.head];
+        window->queue.head = (window->queue.head + 1) % _GLFW_EVENT_QUEUE_SIZE;
+    }
+
+    window->queue.count -= count;
+    return count;
+}
+
 GLFWAPI int glfwJoystickPresent(int jid)
 {
     _GLFWjoystick* js;
@@ -1170,6 +1973,34 @@ GLFWAPI const unsigned char* glfwGetJoystickHats(int jid, int* count)
     return js->hats;
 }
 
+GLFWAPI uint64_t glfwGetJoystickEventTime(int jid)
+{
+    _GLFWjoystick* js;
+
+    assert(jid >= GLFW_JOYSTICK_1);
+    assert(jid <= GLFW_JOYSTICK_LAST);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (jid < 0 || jid > GLFW_JOYSTICK_LAST)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, "Invalid joystick ID %i", jid);
+        return 0;
+    }
+
+    if (!initJoysticks())
+        return 0;
+
+    js = _glfw.joysticks + jid;
+    if (!js->connected)
+        return 0;
+
+    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_ALL))
+        return 0;
+
+    return js->eventTime;
+}
+
 GLFWAPI const char* glfwGetJoystickName(int jid)
 {
     _GLFWjoystick* js;
@@ -1296,17 +2127,13 @@ GLFWAPI int glfwUpdateGamepadMappings(const char* string)
 
                 if (parseMapping(&mapping, line))
                 {
+                    // Built-in mappings that have not been loaded yet are
+                    // shadowed by any mapping added here for the same GUID
                     _GLFWmapping* previous = findMapping(mapping.guid);
                     if (previous)
                         *previous = mapping;
-                    else
-                    {
-                        _glfw.mappingCount++;
-                        _glfw.mappings =
-                            _glfw_realloc(_glfw.mappings,
-                                          sizeof(_GLFWmapping) * _glfw.mappingCount);
-                        _glfw.mappings[_glfw.mappingCount - 1] = mapping;
-                    }
+                    else if (!addMapping(&mapping))
+                        return GLFW_FALSE;
                 }
             }
 
@@ -1323,7 +2150,7 @@ GLFWAPI int glfwUpdateGamepadMappings(const char* string)
     {
         _GLFWjoystick* js = _glfw.joysticks + jid;
         if (js->connected)
-            js->mapping = findValidMapping(js);
+            updateGamepadMapping(js);
     }
 
     return GLFW_TRUE;
@@ -1390,7 +2217,6 @@ GLFWAPI const char* glfwGetGamepadName(int jid)
 
 GLFWAPI int glfwGetGamepadState(int jid, GLFWgamepadstate* state)
 {
-    int i;
     _GLFWjoystick* js;
 
     assert(jid >= GLFW_JOYSTICK_1);
@@ -1420,58 +2246,50 @@ GLFWAPI int glfwGetGamepadState(int jid, GLFWgamepadstate* state)
     if (!js->mapping)
         return GLFW_FALSE;
 
-    for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
+    getGamepadState(js, state);
+
+    return GLFW_TRUE;
+}
+
+GLFWAPI int glfwGetGamepadStates(GLFWgamepadstate* states, int count)
+{
+    int jid, present = 0;
+
+    assert(states != NULL);
+    assert(count >= 0);
+    assert(count <= GLFW_JOYSTICK_LAST + 1);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (count < 0 || count > GLFW_JOYSTICK_LAST + 1)
     {
-        const _GLFWmapelement* e = js->mapping->buttons + i;
-        if (e->type == _GLFW_JOYSTICK_AXIS)
-        {
-            const float value = js->axes[e->index] * e->axisScale + e->axisOffset;
-            // HACK: This should be baked into the value transform
-            // TODO: Bake into transform when implementing output modifiers
-            if (e->axisOffset < 0 || (e->axisOffset == 0 && e->axisScale > 0))
-            {
-                if (value >= 0.f)
-                    state->buttons[i] = GLFW_PRESS;
-            }
-            else
-            {
-                if (value <= 0.f)
-                    state->buttons[i] = GLFW_PRESS;
-            }
-        }
-        else if (e->type == _GLFW_JOYSTICK_HATBIT)
-        {
-            const unsigned int hat = e->index >> 4;
-            const unsigned int bit = e->index & 0xf;
-            if (js->hats[hat] & bit)
-                state->buttons[i] = GLFW_PRESS;
-        }
-        else if (e->type == _GLFW_JOYSTICK_BUTTON)
-            state->buttons[i] = js->buttons[e->index];
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid gamepad state count %i", count);
+        return 0;
     }
 
-    for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+    memset(states, 0, count * sizeof(GLFWgamepadstate));
+
+    if (!initJoysticks())
+        return 0;
+
+    for (jid = 0;  jid < count;  jid++)
     {
-        const _GLFWmapelement* e = js->mapping->axes + i;
-        if (e->type == _GLFW_JOYSTICK_AXIS)
-        {
-            const float value = js->axes[e->index] * e->axisScale + e->axisOffset;
-            state->axes[i] = fminf(fmaxf(value, -1.f), 1.f);
-        }
-        else if (e->type == _GLFW_JOYSTICK_HATBIT)
-        {
-            const unsigned int hat = e->index >> 4;
-            const unsigned int bit = e->index & 0xf;
-            if (js->hats[hat] & bit)
-                state->axes[i] = 1.f;
-            else
-                state->axes[i] = -1.f;
-        }
-        else if (e->type == _GLFW_JOYSTICK_BUTTON)
-            state->axes[i] = js->buttons[e->index] * 2.f - 1.f;
+        _GLFWjoystick* js = _glfw.joysticks + jid;
+        if (!js->connected || !js->mapping)
+            continue;
+
+        if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_ALL))
+            continue;
+
+        // The joystick may have been disconnected or remapped while polling
+        if (!js->mapping)
+            continue;
+
+        getGamepadState(js, states + jid);
+        present |= 1 << jid;
     }
 
-    return GLFW_TRUE;
+    return present;
 }
 
 GLFWAPI void glfwSetClipboardString(GLFWwindow* handle, const char* string)
@@ -1479,7 +2297,9 @@ GLFWAPI void glfwSetClipboardString(GLFWwindow* handle, const char* string)
     assert(string != NULL);
 
     _GLFW_REQUIRE_INIT();
+
     _glfw.platform.setClipboardString(string);
+    _glfwFreeClipboardItems();
 }
 
 GLFWAPI const char* glfwGetClipboardString(GLFWwindow* handle)
@@ -1488,6 +2308,113 @@ GLFWAPI const char* glfwGetClipboardString(GLFWwindow* handle)
     return _glfw.platform.getClipboardString();
 }
 
+GLFWAPI void glfwRequestClipboardString(GLFWclipboardfun callback)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _glfw.callbacks.clipboard = callback;
+    if (callback)
+        _glfw.platform.requestClipboardString();
+}
+
+GLFWAPI void glfwSetClipboardData(const GLFWclipboarditem* items, int count)
+{
+    assert(items != NULL);
+    assert(count > 0);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (count <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid clipboard item count %i", count);
+        return;
+    }
+
+    for (int i = 0;  i < count;  i++)
+    {
+        if (!items[i].type || (!items[i].data && items[i].size))
+        {
+            _glfwInputError(GLFW_INVALID_VALUE, "Invalid clipboard item %i", i);
+            return;
+        }
+    }
+
+    GLFWclipboarditem* copies = _glfw_calloc(count, sizeof(GLFWclipboarditem));
+    const char** types = _glfw_calloc(count, sizeof(char*));
+    if (!copies || !types)
+    {
+        _glfw_free(copies);
+        _glfw_free(types);
+        return;
+    }
+
+    for (int i = 0;  i < count;  i++)
+    {
+        const size_t length = strlen(items[i].type);
+        char* data = _glfw_calloc(items[i].size + length + 1, 1);
+        if (!data)
+        {
+            while (i--)
+                _glfw_free((void*) copies[i].data);
+
+            _glfw_free(copies);
+            _glfw_free(types);
+            return;
+        }
+
+        if (items[i].size)
+            memcpy(data, items[i].data, items[i].size);
+
+        memcpy(data + items[i].size, items[i].type, length + 1);
+
+        copies[i].type = types[i] = data + items[i].size;
+        copies[i].data = data;
+        copies[i].size = items[i].size;
+    }
+
+    GLFWclipboarditem* previousItems = _glfw.clipboard.items;
+    const char** previousTypes = _glfw.clipboard.types;
+    const int previousCount = _glfw.clipboard.count;
+
+    _glfw.clipboard.items = copies;
+    _glfw.clipboard.types = types;
+    _glfw.clipboard.count = count;
+
+    // The platform is done with the previous items once it has the new ones
+    if (!_glfw.platform.setClipboardData())
+    {
+        // The platform rejects the items before changing any of its state
+        _glfw.clipboard.items = previousItems;
+        _glfw.clipboard.types = previousTypes;
+        _glfw.clipboard.count = previousCount;
+        freeClipboardItems(copies, types, count);
+        return;
+    }
+
+    freeClipboardItems(previousItems, previousTypes, previousCount);
+}
+
+GLFWAPI const char** glfwGetClipboardTypes(int* count)
+{
+    assert(count != NULL);
+
+    *count = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    return _glfw.platform.getClipboardTypes(count);
+}
+
+GLFWAPI int glfwReadClipboardData(const char* type,
+                                  GLFWclipboarddatafun callback,
+                                  void* user)
+{
+    assert(type != NULL);
+    assert(callback != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+    return _glfw.platform.readClipboardData(type, callback, user);
+}
+
 GLFWAPI double glfwGetTime(void)
 {
     _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
@@ -1515,6 +2442,12 @@ GLFWAPI uint64_t glfwGetTimerValue(void)
     return _glfwPlatformGetTimerValue();
 }
 
+GLFWAPI uint64_t glfwGetEventTime(void)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+    return getEventTime();
+}
+
 GLFWAPI uint64_t glfwGetTimerFrequency(void)
 {
     _GLFW_REQUIRE_INIT_OR_RETURN(0);
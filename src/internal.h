@@ -59,6 +59,9 @@
 #define _GLFW_POLL_ALL          (_GLFW_POLL_AXES | _GLFW_POLL_BUTTONS)
 
 #define _GLFW_MESSAGE_SIZE      1024
+#define _GLFW_EVENT_QUEUE_SIZE  1024
+#define _GLFW_COUNTER_LAST      GLFW_READBACK_STALLS
+#define _GLFW_CURSOR_HISTORY_SIZE 1024
 
 typedef int GLFWbool;
 typedef void (*GLFWproc)(void);
@@ -68,6 +71,8 @@ typedef struct _GLFWinitconfig  _GLFWinitconfig;
 typedef struct _GLFWwndconfig   _GLFWwndconfig;
 typedef struct _GLFWctxconfig   _GLFWctxconfig;
 typedef struct _GLFWfbconfig    _GLFWfbconfig;
+typedef struct _GLFWfbconfigchoice _GLFWfbconfigchoice;
+typedef struct _GLFWfbconfigcache _GLFWfbconfigcache;
 typedef struct _GLFWcontext     _GLFWcontext;
 typedef struct _GLFWwindow      _GLFWwindow;
 typedef struct _GLFWplatform    _GLFWplatform;
@@ -76,9 +81,15 @@ typedef struct _GLFWmonitor     _GLFWmonitor;
 typedef struct _GLFWcursor      _GLFWcursor;
 typedef struct _GLFWmapelement  _GLFWmapelement;
 typedef struct _GLFWmapping     _GLFWmapping;
+typedef struct _GLFWtransform   _GLFWtransform;
 typedef struct _GLFWjoystick    _GLFWjoystick;
 typedef struct _GLFWtls         _GLFWtls;
 typedef struct _GLFWmutex       _GLFWmutex;
+typedef struct _GLFWwaitfd      _GLFWwaitfd;
+typedef struct _GLFWprocentry   _GLFWprocentry;
+typedef struct _GLFWproccache   _GLFWproccache;
+typedef struct _GLFWreadbackslot _GLFWreadbackslot;
+typedef struct _GLFWreadback    _GLFWreadback;
 
 #define GL_VERSION 0x1f02
 #define GL_NONE 0
@@ -98,17 +109,53 @@ typedef struct _GLFWmutex       _GLFWmutex;
 #define GL_CONTEXT_RELEASE_BEHAVIOR 0x82fb
 #define GL_CONTEXT_RELEASE_BEHAVIOR_FLUSH 0x82fc
 #define GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR 0x00000008
+#define GL_RGBA 0x1908
+#define GL_PACK_ALIGNMENT 0x0d05
+#define GL_READ_BUFFER 0x0c02
+#define GL_FRONT 0x0404
+#define GL_BACK 0x0405
+#define GL_PIXEL_PACK_BUFFER 0x88eb
+#define GL_PIXEL_PACK_BUFFER_BINDING 0x88ed
+#define GL_STREAM_READ 0x88e1
+#define GL_MAP_READ_BIT 0x0001
+#define GL_READ_FRAMEBUFFER 0x8ca8
+#define GL_READ_FRAMEBUFFER_BINDING 0x8caa
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_TIMEOUT_EXPIRED 0x911b
+#define GL_WAIT_FAILED 0x911d
+#define GL_TIMEOUT_IGNORED 0xffffffffffffffffull
 
 typedef int GLint;
 typedef unsigned int GLuint;
 typedef unsigned int GLenum;
 typedef unsigned int GLbitfield;
 typedef unsigned char GLubyte;
+typedef unsigned char GLboolean;
+typedef int GLsizei;
+typedef ptrdiff_t GLintptr;
+typedef ptrdiff_t GLsizeiptr;
+typedef uint64_t GLuint64;
+typedef struct __GLsync* GLsync;
 
 typedef void (APIENTRY * PFNGLCLEARPROC)(GLbitfield);
 typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGPROC)(GLenum);
 typedef void (APIENTRY * PFNGLGETINTEGERVPROC)(GLenum,GLint*);
 typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGIPROC)(GLenum,GLuint);
+typedef void (APIENTRY * PFNGLFLUSHPROC)(void);
+typedef void (APIENTRY * PFNGLPIXELSTOREIPROC)(GLenum,GLint);
+typedef void (APIENTRY * PFNGLREADPIXELSPROC)(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,void*);
+typedef void (APIENTRY * PFNGLREADBUFFERPROC)(GLenum);
+typedef void (APIENTRY * PFNGLGENBUFFERSPROC)(GLsizei,GLuint*);
+typedef void (APIENTRY * PFNGLDELETEBUFFERSPROC)(GLsizei,const GLuint*);
+typedef void (APIENTRY * PFNGLBINDBUFFERPROC)(GLenum,GLuint);
+typedef void (APIENTRY * PFNGLBUFFERDATAPROC)(GLenum,GLsizeiptr,const void*,GLenum);
+typedef void* (APIENTRY * PFNGLMAPBUFFERRANGEPROC)(GLenum,GLintptr,GLsizeiptr,GLbitfield);
+typedef GLboolean (APIENTRY * PFNGLUNMAPBUFFERPROC)(GLenum);
+typedef void (APIENTRY * PFNGLBINDFRAMEBUFFERPROC)(GLenum,GLuint);
+typedef GLsync (APIENTRY * PFNGLFENCESYNCPROC)(GLenum,GLbitfield);
+typedef GLenum (APIENTRY * PFNGLCLIENTWAITSYNCPROC)(GLsync,GLbitfield,GLuint64);
+typedef void (APIENTRY * PFNGLDELETESYNCPROC)(GLsync);
 
 #define EGL_SUCCESS 0x3000
 #define EGL_NOT_INITIALIZED 0x3001
@@ -155,6 +202,8 @@ typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGIPROC)(GLenum,GLuint);
 #define EGL_PBUFFER_BIT 0x0001
 #define EGL_WIDTH 0x3057
 #define EGL_HEIGHT 0x3056
+#define EGL_DRAW 0x3059
+#define EGL_READ 0x305a
 
 #define EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR 0x00000002
 #define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR 0x00000001
@@ -213,6 +262,8 @@ typedef EGLBoolean (APIENTRY * PFN_eglDestroyContext)(EGLDisplay,EGLContext);
 typedef EGLSurface (APIENTRY * PFN_eglCreateWindowSurface)(EGLDisplay,EGLConfig,EGLNativeWindowType,const EGLint*);
 typedef EGLSurface (APIENTRY * PFN_eglCreatePbufferSurface)(EGLDisplay,EGLContext,const EGLint*);
 typedef EGLBoolean (APIENTRY * PFN_eglMakeCurrent)(EGLDisplay,EGLSurface,EGLSurface,EGLContext);
+typedef EGLContext (APIENTRY * PFN_eglGetCurrentContext)(void);
+typedef EGLSurface (APIENTRY * PFN_eglGetCurrentSurface)(EGLint);
 typedef EGLBoolean (APIENTRY * PFN_eglSwapBuffers)(EGLDisplay,EGLSurface);
 typedef EGLBoolean (APIENTRY * PFN_eglSwapInterval)(EGLDisplay,EGLint);
 typedef const char* (APIENTRY * PFN_eglQueryString)(EGLDisplay,EGLint);
@@ -230,6 +281,8 @@ typedef GLFWglproc (APIENTRY * PFN_eglGetProcAddress)(const char*);
 #define eglCreateWindowSurface _glfw.egl.CreateWindowSurface
 #define eglCreatePbufferSurface _glfw.egl.CreatePbufferSurface
 #define eglMakeCurrent _glfw.egl.MakeCurrent
+#define eglGetCurrentContext _glfw.egl.GetCurrentContext
+#define eglGetCurrentSurface _glfw.egl.GetCurrentSurface
 #define eglSwapBuffers _glfw.egl.SwapBuffers
 #define eglSwapInterval _glfw.egl.SwapInterval
 #define eglQueryString _glfw.egl.QueryString
@@ -359,12 +412,31 @@ typedef VkResult (APIENTRY * PFN_vkEnumerateInstanceExtensionProperties)(const c
         y = t;                 \
     }
 
+// Adds to the specified instrumentation counter
+#define _GLFW_COUNT(counter, value) \
+    (_glfw.counters[(counter) & 0xffff] += (value))
+
+// Adds to the specified instrumentation counter from any thread
+#if defined(_MSC_VER)
+ #define _GLFW_COUNT_ATOMIC(counter, value) \
+    InterlockedExchangeAdd64((volatile LONG64*) &_glfw.counters[(counter) & 0xffff], \
+                             (LONG64) (value))
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+ #define _GLFW_COUNT_ATOMIC(counter, value) \
+    __atomic_fetch_add(&_glfw.counters[(counter) & 0xffff], (value), __ATOMIC_RELAXED)
+#else
+ // 64-bit atomics would need libatomic on targets like 32-bit PowerPC
+ #define _GLFW_COUNT_ATOMIC(counter, value) \
+    _glfwCountAtomic((counter), (value))
+#endif
+
 // Per-thread error structure
 //
 struct _GLFWerror
 {
     _GLFWerror*     next;
     int             code;
+    // The formatted description, or empty if the error has the default one
     char            description[_GLFW_MESSAGE_SIZE];
 };
 
@@ -384,6 +456,8 @@ struct _GLFWinitconfig
     } ns;
     struct {
         GLFWbool  xcbVulkanSurface;
+        int       eventBudget;
+        int       eventTimeBudget;
     } x11;
     struct {
         int       libdecorMode;
@@ -449,6 +523,7 @@ struct _GLFWctxconfig
     int           profile;
     int           robustness;
     int           release;
+    int           readbackBuffers;
     _GLFWwindow*  share;
     struct {
         GLFWbool  offline;
@@ -484,6 +559,29 @@ struct _GLFWfbconfig
     uintptr_t   handle;
 };
 
+// Framebuffer config chosen for a set of framebuffer hints
+//
+struct _GLFWfbconfigchoice
+{
+    _GLFWfbconfig   desired;
+    // Backend-specific bits that took part in the choice
+    int             mask;
+    uintptr_t       handle;
+};
+
+// Framebuffer configs of the display, translated once by a context creation
+// API and kept until it is terminated, along with the choices made from them
+//
+struct _GLFWfbconfigcache
+{
+    _GLFWfbconfig*  configs;
+    // Backend-specific bits of each config that are matched against the hints
+    int*            masks;
+    int             count;
+    _GLFWfbconfigchoice* choices;
+    int             choiceCount;
+};
+
 // Context structure
 //
 struct _GLFWcontext
@@ -500,10 +598,24 @@ struct _GLFWcontext
     PFNGLGETINTEGERVPROC GetIntegerv;
     PFNGLGETSTRINGPROC   GetString;
 
+    // Client and platform extension names, each ending with a null character,
+    // and an open addressing hash table of name offsets plus one
+    char*               extensionNames;
+    int*                extensionIndex;
+    int                 extensionIndexSize;
+
+    _GLFWproccache*     procs;
+
+    int                 readbackBuffers;
+    // Created at the first buffer swap with a readback callback set
+    _GLFWreadback*      readback;
+
     void (*makeCurrent)(_GLFWwindow*);
+    // NULL if making the context current again may not be a no-op
+    GLFWbool (*isCurrent)(_GLFWwindow*);
     void (*swapBuffers)(_GLFWwindow*);
     void (*swapInterval)(int);
-    int (*extensionSupported)(const char*);
+    const char* (*getExtensionString)(void);
     GLFWglproc (*getProcAddress)(const char*);
     void (*destroy)(_GLFWwindow*);
 
@@ -512,6 +624,9 @@ struct _GLFWcontext
         EGLContext      handle;
         EGLSurface      surface;
         void*           client;
+        // The pbuffer size and color space on the surfaceless platform
+        int             width, height;
+        GLFWbool        sRGB;
     } egl;
 
     struct {
@@ -561,6 +676,24 @@ struct _GLFWwindow
     double              virtualCursorPosX, virtualCursorPosY;
     GLFWbool            rawMouseMotion;
 
+    // Ring buffer of input events, allocated when the event queue is enabled
+    struct {
+        GLFWevent*      events;
+        int             head;
+        int             count;
+    } queue;
+
+    // Cursor motion merged over one event processing pass, with the optional
+    // history of every position it passed through
+    struct {
+        GLFWbool        coalesce;
+        GLFWbool        pending;
+        uint64_t        time;
+        double          xdelta, ydelta;
+        GLFWevent*      history;
+        int             count;
+    } motion;
+
     _GLFWcontext        context;
 
     struct {
@@ -581,6 +714,7 @@ struct _GLFWwindow
         GLFWcharfun               character;
         GLFWcharmodsfun           charmods;
         GLFWdropfun               drop;
+        GLFWreadbackfun           readback;
     } callbacks;
 
     // This is defined in platform.h
@@ -602,6 +736,9 @@ struct _GLFWmonitor
 
     GLFWvidmode*    modes;
     int             modeCount;
+    // The modes last returned by glfwGetVideoModes, if they have since been
+    // replaced and may still be in use by the application
+    GLFWvidmode*    previousModes;
     GLFWvidmode     currentMode;
 
     GLFWgammaramp   originalRamp;
@@ -640,6 +777,20 @@ struct _GLFWmapping
     _GLFWmapelement axes[6];
 };
 
+// Gamepad element transform structure
+// This is a mapping element resolved so that every element type is reduced to
+// a source value that is scaled and offset, then clamped for axes or compared
+// with zero for buttons
+//
+struct _GLFWtransform
+{
+    uint8_t         type;
+    uint8_t         index;
+    uint8_t         bit;
+    float           scale;
+    float           offset;
+};
+
 // Joystick structure
 //
 struct _GLFWjoystick
@@ -652,15 +803,30 @@ struct _GLFWjoystick
     int             buttonCount;
     unsigned char*  hats;
     int             hatCount;
+    uint64_t        eventTime;
     char            name[128];
     void*           userPointer;
     char            guid[33];
     _GLFWmapping*   mapping;
+    _GLFWtransform  buttonTransforms[15];
+    _GLFWtransform  axisTransforms[6];
 
     // This is defined in platform.h
     GLFW_PLATFORM_JOYSTICK_STATE
 };
 
+// Application file descriptor added to the event wait set
+//
+struct _GLFWwaitfd
+{
+    int             fd;
+    int             events;
+    // Readiness flags found by the last wait and not yet dispatched
+    int             ready;
+    GLFWwaitfdfun   callback;
+    void*           user;
+};
+
 // Thread local storage structure
 //
 struct _GLFWtls
@@ -677,6 +843,78 @@ struct _GLFWmutex
     GLFW_PLATFORM_MUTEX_STATE
 };
 
+// Entry point cache entry
+//
+struct _GLFWprocentry
+{
+    // Offset plus one of the name in the name buffer, or zero if empty
+    int             name;
+    GLFWglproc      proc;
+};
+
+// Entry point cache shared by contexts that resolve to the same entry points
+//
+struct _GLFWproccache
+{
+    _GLFWproccache* next;
+    int             refcount;
+    // Whether contexts other than the share group of the first one may use it
+    GLFWbool        shared;
+    GLFWglproc      (*getProcAddress)(const char*);
+    int             client;
+    // Whether OpenGL ES 1 was requested, as EGL loads a separate library for it
+    GLFWbool        es1;
+    // Contexts using the cache may be current on different threads
+    _GLFWmutex      lock;
+    char*           names;
+    size_t          nameSize;
+    size_t          nameCapacity;
+    // Open addressing hash table of the resolved entry points, including
+    // those that were not found
+    _GLFWprocentry* entries;
+    int             entryCount;
+    int             entrySize;
+};
+
+// Asynchronous readback slot holding one frame
+//
+struct _GLFWreadbackslot
+{
+    GLuint          buffer;
+    GLsizeiptr      size;
+    // The fence of the pending frame, or NULL if the slot is free
+    GLsync          fence;
+    int             width;
+    int             height;
+    uint64_t        frame;
+};
+
+// Asynchronous readback ring of a context
+//
+struct _GLFWreadback
+{
+    _GLFWreadbackslot* slots;
+    int             count;
+    // The slot for the next frame, which is also the oldest if all are pending
+    int             next;
+    uint64_t        frame;
+
+    PFNGLFLUSHPROC              Flush;
+    PFNGLPIXELSTOREIPROC        PixelStorei;
+    PFNGLREADPIXELSPROC         ReadPixels;
+    PFNGLREADBUFFERPROC         ReadBuffer;
+    PFNGLGENBUFFERSPROC         GenBuffers;
+    PFNGLDELETEBUFFERSPROC      DeleteBuffers;
+    PFNGLBINDBUFFERPROC         BindBuffer;
+    PFNGLBUFFERDATAPROC         BufferData;
+    PFNGLMAPBUFFERRANGEPROC     MapBufferRange;
+    PFNGLUNMAPBUFFERPROC        UnmapBuffer;
+    PFNGLBINDFRAMEBUFFERPROC    BindFramebuffer;
+    PFNGLFENCESYNCPROC          FenceSync;
+    PFNGLCLIENTWAITSYNCPROC     ClientWaitSync;
+    PFNGLDELETESYNCPROC         DeleteSync;
+};
+
 // Platform API structure
 //
 struct _GLFWplatform
@@ -699,6 +937,10 @@ struct _GLFWplatform
     int (*getKeyScancode)(int);
     void (*setClipboardString)(const char*);
     const char* (*getClipboardString)(void);
+    void (*requestClipboardString)(void);
+    GLFWbool (*setClipboardData)(void);
+    const char** (*getClipboardTypes)(int*);
+    GLFWbool (*readClipboardData)(const char*,GLFWclipboarddatafun,void*);
     GLFWbool (*initJoysticks)(void);
     void (*terminateJoysticks)(void);
     GLFWbool (*pollJoystick)(_GLFWjoystick*,int);
@@ -750,6 +992,7 @@ struct _GLFWplatform
     void (*pollEvents)(void);
     void (*waitEvents)(void);
     void (*waitEventsTimeout)(double);
+    void (*waitEventsUntil)(uint64_t);
     void (*postEmptyEvent)(void);
     // EGL
     EGLenum (*getEGLPlatform)(EGLint**);
@@ -778,7 +1021,7 @@ struct _GLFWlibrary
         int             refreshRate;
     } hints;
 
-    _GLFWerror*         errorListHead;
+    _GLFWerror* volatile errorListHead;
     _GLFWcursor*        cursorListHead;
     _GLFWwindow*        windowListHead;
 
@@ -789,10 +1032,20 @@ struct _GLFWlibrary
     _GLFWjoystick       joysticks[GLFW_JOYSTICK_LAST + 1];
     _GLFWmapping*       mappings;
     int                 mappingCount;
+    int                 mappingCapacity;
+    // Open addressing hash table of mapping indices plus one, keyed by GUID
+    int*                mappingIndex;
+    int                 mappingIndexSize;
+    // Normalized GUIDs of the built-in mapping strings, 33 bytes per entry
+    char*               defaultMappingGUIDs;
+
+    _GLFWwaitfd*        waitFds;
+    int                 waitFdCount;
+
+    _GLFWproccache*     procCacheListHead;
 
     _GLFWtls            errorSlot;
     _GLFWtls            contextSlot;
-    _GLFWmutex          errorLock;
 
     struct {
         uint64_t        offset;
@@ -800,10 +1053,24 @@ struct _GLFWlibrary
         GLFW_PLATFORM_LIBRARY_TIMER_STATE
     } timer;
 
+    struct {
+        // Timer value of the platform event being processed or zero if unknown
+        uint64_t        current;
+        // Mapping of the millisecond event clock of the window system
+        GLFWbool        synced;
+        uint32_t        last;
+        int64_t         milliseconds;
+        int64_t         offset;
+        // Mapping of the separate microsecond clock of Wayland relative motion
+        GLFWbool        microsecondsSynced;
+        int64_t         microsecondsOffset;
+    } eventTime;
+
     struct {
         EGLenum         platform;
         EGLDisplay      display;
         EGLint          major, minor;
+        _GLFWfbconfigcache* configs;
         GLFWbool        prefix;
 
         GLFWbool        KHR_create_context;
@@ -838,6 +1105,8 @@ struct _GLFWlibrary
         PFN_eglCreateWindowSurface  CreateWindowSurface;
         PFN_eglCreatePbufferSurface CreatePbufferSurface;
         PFN_eglMakeCurrent          MakeCurrent;
+        PFN_eglGetCurrentContext    GetCurrentContext;
+        PFN_eglGetCurrentSurface    GetCurrentSurface;
         PFN_eglSwapBuffers          SwapBuffers;
         PFN_eglSwapInterval         SwapInterval;
         PFN_eglQueryString          QueryString;
@@ -878,8 +1147,23 @@ struct _GLFWlibrary
     struct {
         GLFWmonitorfun  monitor;
         GLFWjoystickfun joystick;
+        // The callback of the pending clipboard string request, if any
+        GLFWclipboardfun clipboard;
     } callbacks;
 
+    // Clipboard items set with glfwSetClipboardData, with each type string
+    // stored after the data in the same allocation
+    struct {
+        GLFWclipboarditem* items;
+        const char**    types;
+        int             count;
+    } clipboard;
+
+    // Instrumentation counters, indexed by the low bits of the counter token
+    uint64_t            counters[(_GLFW_COUNTER_LAST & 0xffff) + 1];
+    // Guards counters shared between threads where 64-bit atomics are missing
+    volatile int        counterLock;
+
     // These are defined in platform.h
     GLFW_PLATFORM_LIBRARY_WINDOW_STATE
     GLFW_PLATFORM_LIBRARY_CONTEXT_STATE
@@ -908,6 +1192,9 @@ GLFWbool _glfwPlatformCreateMutex(_GLFWmutex* mutex);
 void _glfwPlatformDestroyMutex(_GLFWmutex* mutex);
 void _glfwPlatformLockMutex(_GLFWmutex* mutex);
 void _glfwPlatformUnlockMutex(_GLFWmutex* mutex);
+void* _glfwPlatformCompareExchangePointer(void* volatile* target,
+                                          void* comparand,
+                                          void* value);
 
 void* _glfwPlatformLoadModule(const char* path);
 void _glfwPlatformFreeModule(void* module);
@@ -929,6 +1216,7 @@ void _glfwInputWindowMaximize(_GLFWwindow* window, GLFWbool maximized);
 void _glfwInputWindowDamage(_GLFWwindow* window);
 void _glfwInputWindowCloseRequest(_GLFWwindow* window);
 void _glfwInputWindowMonitor(_GLFWwindow* window, _GLFWmonitor* monitor);
+void _glfwInputWaitFds(void);
 
 void _glfwInputKey(_GLFWwindow* window,
                    int key, int scancode, int action, int mods);
@@ -939,6 +1227,8 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
 void _glfwInputCursorPos(_GLFWwindow* window, double xpos, double ypos);
 void _glfwInputCursorEnter(_GLFWwindow* window, GLFWbool entered);
 void _glfwInputDrop(_GLFWwindow* window, int count, const char** names);
+void _glfwInputEventTime(uint64_t time);
+void _glfwInputClipboardString(const char* string);
 void _glfwInputJoystick(_GLFWjoystick* js, int event);
 void _glfwInputJoystickAxis(_GLFWjoystick* js, int axis, float value);
 void _glfwInputJoystickButton(_GLFWjoystick* js, int button, char value);
@@ -965,20 +1255,30 @@ GLFWbool _glfwStringInExtensionString(const char* string, const char* extensions
 const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
                                          const _GLFWfbconfig* alternatives,
                                          unsigned int count);
+uintptr_t _glfwFindFBConfigChoice(const _GLFWfbconfigcache* cache,
+                                  const _GLFWfbconfig* desired,
+                                  int mask);
+void _glfwAddFBConfigChoice(_GLFWfbconfigcache* cache,
+                            const _GLFWfbconfig* desired,
+                            int mask,
+                            uintptr_t handle);
+void _glfwFreeFBConfigCache(_GLFWfbconfigcache* cache);
 GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
                                     const _GLFWctxconfig* ctxconfig);
 GLFWbool _glfwIsValidContextConfig(const _GLFWctxconfig* ctxconfig);
+void _glfwReleaseProcCache(_GLFWwindow* window);
+void _glfwFreeReadback(_GLFWwindow* window);
 
 const GLFWvidmode* _glfwChooseVideoMode(_GLFWmonitor* monitor,
                                         const GLFWvidmode* desired);
 int _glfwCompareVideoModes(const GLFWvidmode* first, const GLFWvidmode* second);
 _GLFWmonitor* _glfwAllocMonitor(const char* name, int widthMM, int heightMM);
 void _glfwFreeMonitor(_GLFWmonitor* monitor);
+void _glfwInvalidateVideoModes(_GLFWmonitor* monitor);
 void _glfwAllocGammaArrays(GLFWgammaramp* ramp, unsigned int size);
 void _glfwFreeGammaArrays(GLFWgammaramp* ramp);
 void _glfwSplitBPP(int bpp, int* red, int* green, int* blue);
 
-void _glfwInitGamepadMappings(void);
 _GLFWjoystick* _glfwAllocJoystick(const char* name,
                                   const char* guid,
                                   int axisCount,
@@ -986,12 +1286,24 @@ _GLFWjoystick* _glfwAllocJoystick(const char* name,
                                   int hatCount);
 void _glfwFreeJoystick(_GLFWjoystick* js);
 void _glfwCenterCursorInContentArea(_GLFWwindow* window);
+void _glfwBeginEventProcessing(void);
+void _glfwEndEventProcessing(void);
+void _glfwFreeClipboardItems(void);
+const GLFWclipboarditem* _glfwFindClipboardItem(const char* type);
+char* _glfwCopyClipboardItemString(void);
+uint64_t _glfwConvertEventTime(uint32_t milliseconds);
+uint64_t _glfwConvertEventTimeMicroseconds(uint64_t microseconds);
+uint64_t _glfwGetDeadline(double timeout);
+double _glfwGetTimeoutUntil(uint64_t deadline);
 
 GLFWbool _glfwInitEGL(void);
 void _glfwTerminateEGL(void);
 GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
                                const _GLFWctxconfig* ctxconfig,
                                const _GLFWfbconfig* fbconfig);
+GLFWbool _glfwPreloadConfigsEGL(const _GLFWctxconfig* ctxconfig,
+                                const _GLFWfbconfig* fbconfig);
+void _glfwResizeSurfaceEGL(_GLFWwindow* window);
 #if defined(_GLFW_X11)
 GLFWbool _glfwChooseVisualEGL(const _GLFWwndconfig* wndconfig,
                               const _GLFWctxconfig* ctxconfig,
@@ -1012,6 +1324,10 @@ const char* _glfwGetVulkanResultString(VkResult result);
 size_t _glfwEncodeUTF8(char* s, uint32_t codepoint);
 char** _glfwParseUriList(char* text, int* count);
 
+void _glfwConvertPixels(uint32_t* target, const unsigned char* source, int count);
+void _glfwPremultiplyPixels(uint32_t* target, const unsigned char* source, int count);
+void _glfwWidenPixels(unsigned long* target, const unsigned char* source, int count);
+
 char* _glfw_strdup(const char* source);
 int _glfw_min(int a, int b);
 int _glfw_max(int a, int b);
@@ -1020,3 +1336,7 @@ void* _glfw_calloc(size_t count, size_t size);
 void* _glfw_realloc(void* pointer, size_t size);
 void _glfw_free(void* pointer);
 
+#if !defined(_MSC_VER) && !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+void _glfwCountAtomic(int counter, uint64_t value);
+#endif
+
@@ -32,6 +32,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/inotify.h>
+#include <sys/epoll.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <dirent.h>
@@ -45,6 +46,11 @@
 #define SYN_DROPPED 3
 #endif
 
+#ifndef input_event_sec // < v4.16 kernel headers
+#define input_event_sec time.tv_sec
+#define input_event_usec time.tv_usec
+#endif
+
 // Apply an EV_KEY event to the specified joystick
 //
 static void handleKeyEvent(_GLFWjoystick* js, int code, int value)
@@ -120,6 +126,17 @@ static void pollAbsState(_GLFWjoystick* js)
     }
 }
 
+// Returns whether the specified device node name is that of an event device
+//
+static GLFWbool isEventDevice(const char* name)
+{
+    if (strncmp(name, "event", 5) != 0)
+        return GLFW_FALSE;
+
+    name += 5;
+    return *name && strspn(name, "0123456789") == strlen(name);
+}
+
 #define isBitSet(bit, arr) (arr[(bit) / 8] & (1 << ((bit) % 8)))
 
 // Attempt to open the specified joystick device
@@ -163,6 +180,14 @@ static GLFWbool openJoystickDevice(const char* path)
         return GLFW_FALSE;
     }
 
+    // Have the kernel timestamp events with the clock used by the timer
+    if (_glfw.timer.posix.clock == CLOCK_MONOTONIC)
+    {
+        int clock = CLOCK_MONOTONIC;
+        if (ioctl(linjs.fd, EVIOCSCLOCKID, &clock) == 0)
+            linjs.monotonic = GLFW_TRUE;
+    }
+
     char name[256] = "";
 
     if (ioctl(linjs.fd, EVIOCGNAME(sizeof(name)), name) < 0)
@@ -233,6 +258,13 @@ static GLFWbool openJoystickDevice(const char* path)
     strncpy(linjs.path, path, sizeof(linjs.path) - 1);
     memcpy(&js->linjs, &linjs, sizeof(linjs));
 
+    if (_glfw.linjs.epoll > 0)
+    {
+        struct epoll_event event = { EPOLLIN };
+        event.data.fd = linjs.fd;
+        epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_ADD, linjs.fd, &event);
+    }
+
     pollAbsState(js);
 
     _glfwInputJoystick(js, GLFW_CONNECTED);
@@ -246,6 +278,10 @@ static GLFWbool openJoystickDevice(const char* path)
 static void closeJoystick(_GLFWjoystick* js)
 {
     _glfwInputJoystick(js, GLFW_DISCONNECTED);
+
+    if (_glfw.linjs.epoll > 0)
+        epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_DEL, js->linjs.fd, NULL);
+
     close(js->linjs.fd);
     _glfwFreeJoystick(js);
 }
@@ -259,12 +295,9 @@ static int compareJoysticks(const void* fp, const void* sp)
     return strcmp(fj->linjs.path, sj->linjs.path);
 }
 
-
-//////////////////////////////////////////////////////////////////////////
-//////                       GLFW internal API                      //////
-//////////////////////////////////////////////////////////////////////////
-
-void _glfwDetectJoystickConnectionLinux(void)
+// Opens and closes joysticks as reported by inotify
+//
+static void detectJoystickConnection(void)
 {
     if (_glfw.linjs.inotify <= 0)
         return;
@@ -275,12 +308,11 @@ void _glfwDetectJoystickConnectionLinux(void)
 
     while (size > offset)
     {
-        regmatch_t match;
         const struct inotify_event* e = (struct inotify_event*) (buffer + offset);
 
         offset += sizeof(struct inotify_event) + e->len;
 
-        if (regexec(&_glfw.linjs.regex, e->name, 1, &match, 0) != 0)
+        if (!isEventDevice(e->name))
             continue;
 
         char path[PATH_MAX];
@@ -302,6 +334,101 @@ void _glfwDetectJoystickConnectionLinux(void)
     }
 }
 
+// Reads and applies all queued events of the specified joystick
+// Events are read in batches and the absolute axis state is only queried again
+// after the kernel has dropped events
+//
+static void readJoystickEvents(_GLFWjoystick* js)
+{
+    for (;;)
+    {
+        struct input_event events[64];
+        const ssize_t size = read(js->linjs.fd, events, sizeof(events));
+        if (size < 0)
+        {
+            // Reset the joystick slot if the device was disconnected
+            if (errno == ENODEV)
+                closeJoystick(js);
+            else if (errno == EINTR)
+                continue;
+
+            return;
+        }
+
+        const size_t count = size / sizeof(struct input_event);
+
+        for (size_t i = 0;  i < count;  i++)
+        {
+            const struct input_event* e = events + i;
+
+            if (js->linjs.monotonic)
+            {
+                _glfwInputEventTime((uint64_t) e->input_event_sec * 1000000000 +
+                                    (uint64_t) e->input_event_usec * 1000);
+            }
+
+            if (e->type == EV_SYN)
+            {
+                if (e->code == SYN_DROPPED)
+                    js->linjs.dropped = GLFW_TRUE;
+                else if (e->code == SYN_REPORT && js->linjs.dropped)
+                {
+                    js->linjs.dropped = GLFW_FALSE;
+                    pollAbsState(js);
+                }
+            }
+
+            if (js->linjs.dropped)
+                continue;
+
+            if (e->type == EV_KEY)
+                handleKeyEvent(js, e->code, e->value);
+            else if (e->type == EV_ABS)
+                handleAbsEvent(js, e->code, e->value);
+        }
+
+        _glfwInputEventTime(0);
+
+        // A short read means the queue has been drained
+        if (count < sizeof(events) / sizeof(events[0]))
+            return;
+    }
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+void _glfwProcessJoystickEventsLinux(void)
+{
+    if (_glfw.linjs.epoll <= 0)
+        return;
+
+    struct epoll_event events[GLFW_JOYSTICK_LAST + 2];
+    const int count = epoll_wait(_glfw.linjs.epoll, events,
+                                 sizeof(events) / sizeof(events[0]), 0);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        if (events[i].data.fd == _glfw.linjs.inotify)
+        {
+            detectJoystickConnection();
+            continue;
+        }
+
+        for (int jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+        {
+            _GLFWjoystick* js = _glfw.joysticks + jid;
+            if (js->connected && js->linjs.fd == events[i].data.fd)
+            {
+                readJoystickEvents(js);
+                break;
+            }
+        }
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -324,11 +451,14 @@ GLFWbool _glfwInitJoysticksLinux(void)
 
     // Continue without device connection notifications if inotify fails
 
-    _glfw.linjs.regexCompiled = (regcomp(&_glfw.linjs.regex, "^event[0-9]\\+$", 0) == 0);
-    if (!_glfw.linjs.regexCompiled)
+    // The inotify and device file descriptors share an epoll instance so that
+    // the event processing functions can wait on and drain all of them at once
+    _glfw.linjs.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (_glfw.linjs.epoll > 0 && _glfw.linjs.inotify > 0)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR, "Linux: Failed to compile regex");
-        return GLFW_FALSE;
+        struct epoll_event event = { EPOLLIN };
+        event.data.fd = _glfw.linjs.inotify;
+        epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_ADD, _glfw.linjs.inotify, &event);
     }
 
     int count = 0;
@@ -340,9 +470,7 @@ GLFWbool _glfwInitJoysticksLinux(void)
 
         while ((entry = readdir(dir)))
         {
-            regmatch_t match;
-
-            if (regexec(&_glfw.linjs.regex, entry->d_name, 1, &match, 0) != 0)
+            if (!isEventDevice(entry->d_name))
                 continue;
 
             char path[PATH_MAX];
@@ -379,47 +507,13 @@ void _glfwTerminateJoysticksLinux(void)
         close(_glfw.linjs.inotify);
     }
 
-    if (_glfw.linjs.regexCompiled)
-        regfree(&_glfw.linjs.regex);
+    if (_glfw.linjs.epoll > 0)
+        close(_glfw.linjs.epoll);
 }
 
 GLFWbool _glfwPollJoystickLinux(_GLFWjoystick* js, int mode)
 {
-    // Read all queued events (non-blocking)
-    for (;;)
-    {
-        struct input_event e;
-
-        errno = 0;
-        if (read(js->linjs.fd, &e, sizeof(e)) < 0)
-        {
-            // Reset the joystick slot if the device was disconnected
-            if (errno == ENODEV)
-                closeJoystick(js);
-
-            break;
-        }
-
-        if (e.type == EV_SYN)
-        {
-            if (e.code == SYN_DROPPED)
-                _glfw.linjs.dropped = GLFW_TRUE;
-            else if (e.code == SYN_REPORT)
-            {
-                _glfw.linjs.dropped = GLFW_FALSE;
-                pollAbsState(js);
-            }
-        }
-
-        if (_glfw.linjs.dropped)
-            continue;
-
-        if (e.type == EV_KEY)
-            handleKeyEvent(js, e.code, e.value);
-        else if (e.type == EV_ABS)
-            handleAbsEvent(js, e.code, e.value);
-    }
-
+    readJoystickEvents(js);
     return js->connected;
 }
 
@@ -26,7 +26,6 @@
 
 #include <linux/input.h>
 #include <linux/limits.h>
-#include <regex.h>
 
 #define GLFW_LINUX_JOYSTICK_STATE         _GLFWjoystickLinux linjs;
 #define GLFW_LINUX_LIBRARY_JOYSTICK_STATE _GLFWlibraryLinux  linjs;
@@ -41,6 +40,8 @@ typedef struct _GLFWjoystickLinux
     int                     absMap[ABS_CNT];
     struct input_absinfo    absInfo[ABS_CNT];
     int                     hats[4][2];
+    GLFWbool                dropped;
+    GLFWbool                monotonic;
 } _GLFWjoystickLinux;
 
 // Linux-specific joystick API data
@@ -49,12 +50,10 @@ typedef struct _GLFWlibraryLinux
 {
     int                     inotify;
     int                     watch;
-    regex_t                 regex;
-    GLFWbool                regexCompiled;
-    GLFWbool                dropped;
+    int                     epoll;
 } _GLFWlibraryLinux;
 
-void _glfwDetectJoystickConnectionLinux(void);
+void _glfwProcessJoystickEventsLinux(void);
 
 GLFWbool _glfwInitJoysticksLinux(void);
 void _glfwTerminateJoysticksLinux(void);
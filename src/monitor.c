@@ -191,10 +191,26 @@ void _glfwFreeMonitor(_GLFWmonitor* monitor)
     _glfwFreeGammaArrays(&monitor->originalRamp);
     _glfwFreeGammaArrays(&monitor->currentRamp);
 
+    _glfw_free(monitor->previousModes);
     _glfw_free(monitor->modes);
     _glfw_free(monitor);
 }
 
+// Makes shared code retrieve the modes of the specified monitor again
+// The array returned by glfwGetVideoModes is kept until it is next called
+//
+void _glfwInvalidateVideoModes(_GLFWmonitor* monitor)
+{
+    // Modes retrieved since the last invalidation were never returned
+    if (monitor->previousModes)
+        _glfw_free(monitor->modes);
+    else
+        monitor->previousModes = monitor->modes;
+
+    monitor->modes = NULL;
+    monitor->modeCount = 0;
+}
+
 // Allocates red, green and blue value arrays of the specified size
 //
 void _glfwAllocGammaArrays(GLFWgammaramp* ramp, unsigned int size)
@@ -441,6 +457,9 @@ GLFWAPI const GLFWvidmode* glfwGetVideoModes(GLFWmonitor* handle, int* count)
     _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
     assert(monitor != NULL);
 
+    _glfw_free(monitor->previousModes);
+    monitor->previousModes = NULL;
+
     if (!refreshVideoModes(monitor))
         return NULL;
 
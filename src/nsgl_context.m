@@ -46,6 +46,11 @@ static void makeContextCurrentNSGL(_GLFWwindow* window)
     } // autoreleasepool
 }
 
+static GLFWbool isContextCurrentNSGL(_GLFWwindow* window)
+{
+    return [NSOpenGLContext currentContext] == window->context.nsgl.object;
+}
+
 static void swapBuffersNSGL(_GLFWwindow* window)
 {
     @autoreleasepool {
@@ -90,10 +95,10 @@ static void swapIntervalNSGL(int interval)
     } // autoreleasepool
 }
 
-static int extensionSupportedNSGL(const char* extension)
+static const char* getExtensionStringNSGL(void)
 {
     // There are no NSGL extensions
-    return GLFW_FALSE;
+    return NULL;
 }
 
 static GLFWglproc getProcAddressNSGL(const char* procname)
@@ -343,9 +348,10 @@ GLFWbool _glfwCreateContextNSGL(_GLFWwindow* window,
     [window->context.nsgl.object setView:window->ns.view];
 
     window->context.makeCurrent = makeContextCurrentNSGL;
+    window->context.isCurrent = isContextCurrentNSGL;
     window->context.swapBuffers = swapBuffersNSGL;
     window->context.swapInterval = swapIntervalNSGL;
-    window->context.extensionSupported = extensionSupportedNSGL;
+    window->context.getExtensionString = getExtensionStringNSGL;
     window->context.getProcAddress = getProcAddressNSGL;
     window->context.destroy = destroyContextNSGL;
 
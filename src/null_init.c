@@ -55,6 +55,10 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeNull,
         .setClipboardString = _glfwSetClipboardStringNull,
         .getClipboardString = _glfwGetClipboardStringNull,
+        .requestClipboardString = _glfwRequestClipboardStringNull,
+        .setClipboardData = _glfwSetClipboardDataNull,
+        .getClipboardTypes = _glfwGetClipboardTypesNull,
+        .readClipboardData = _glfwReadClipboardDataNull,
         .initJoysticks = _glfwInitJoysticksNull,
         .terminateJoysticks = _glfwTerminateJoysticksNull,
         .pollJoystick = _glfwPollJoystickNull,
@@ -104,6 +108,7 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         .pollEvents = _glfwPollEventsNull,
         .waitEvents = _glfwWaitEventsNull,
         .waitEventsTimeout = _glfwWaitEventsTimeoutNull,
+        .waitEventsUntil = _glfwWaitEventsUntilNull,
         .postEmptyEvent = _glfwPostEmptyEventNull,
         .getEGLPlatform = _glfwGetEGLPlatformNull,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayNull,
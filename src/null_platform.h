@@ -257,6 +257,7 @@ GLFWbool _glfwWindowVisibleNull(_GLFWwindow* window);
 void _glfwPollEventsNull(void);
 void _glfwWaitEventsNull(void);
 void _glfwWaitEventsTimeoutNull(double timeout);
+void _glfwWaitEventsUntilNull(uint64_t deadline);
 void _glfwPostEmptyEventNull(void);
 void _glfwGetCursorPosNull(_GLFWwindow* window, double* xpos, double* ypos);
 void _glfwSetCursorPosNull(_GLFWwindow* window, double x, double y);
@@ -267,6 +268,10 @@ void _glfwDestroyCursorNull(_GLFWcursor* cursor);
 void _glfwSetCursorNull(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringNull(const char* string);
 const char* _glfwGetClipboardStringNull(void);
+void _glfwRequestClipboardStringNull(void);
+GLFWbool _glfwSetClipboardDataNull(void);
+const char** _glfwGetClipboardTypesNull(int* count);
+GLFWbool _glfwReadClipboardDataNull(const char* type, GLFWclipboarddatafun callback, void* user);
 const char* _glfwGetScancodeNameNull(int scancode);
 int _glfwGetKeyScancodeNull(int key);
 
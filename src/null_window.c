@@ -213,6 +213,9 @@ void _glfwSetWindowMonitorNull(_GLFWwindow* window,
         window->null.visible = GLFW_TRUE;
         acquireMonitor(window);
         fitToMonitor(window);
+
+        if (window->context.source == GLFW_EGL_CONTEXT_API)
+            _glfwResizeSurfaceEGL(window);
     }
     else
     {
@@ -259,6 +262,10 @@ void _glfwSetWindowSizeNull(_GLFWwindow* window, int width, int height)
     {
         window->null.width = width;
         window->null.height = height;
+
+        if (window->context.source == GLFW_EGL_CONTEXT_API)
+            _glfwResizeSurfaceEGL(window);
+
         _glfwInputFramebufferSize(window, width, height);
         _glfwInputWindowDamage(window);
         _glfwInputWindowSize(window, width, height);
@@ -497,6 +504,10 @@ void _glfwWaitEventsTimeoutNull(double timeout)
 {
 }
 
+void _glfwWaitEventsUntilNull(uint64_t deadline)
+{
+}
+
 void _glfwPostEmptyEventNull(void)
 {
 }
@@ -551,6 +562,62 @@ const char* _glfwGetClipboardStringNull(void)
     return _glfw.null.clipboardString;
 }
 
+void _glfwRequestClipboardStringNull(void)
+{
+    _glfwInputClipboardString(_glfwGetClipboardStringNull());
+}
+
+GLFWbool _glfwSetClipboardDataNull(void)
+{
+    _glfw_free(_glfw.null.clipboardString);
+    _glfw.null.clipboardString = _glfwCopyClipboardItemString();
+    return GLFW_TRUE;
+}
+
+const char** _glfwGetClipboardTypesNull(int* count)
+{
+    static const char* textTypes[] = { "text/plain;charset=utf-8" };
+
+    if (_glfw.clipboard.count)
+    {
+        *count = _glfw.clipboard.count;
+        return _glfw.clipboard.types;
+    }
+
+    if (_glfw.null.clipboardString)
+    {
+        *count = 1;
+        return textTypes;
+    }
+
+    return NULL;
+}
+
+GLFWbool _glfwReadClipboardDataNull(const char* type,
+                                    GLFWclipboarddatafun callback,
+                                    void* user)
+{
+    const GLFWclipboarditem* item = _glfwFindClipboardItem(type);
+    if (item)
+    {
+        callback(item->data, item->size, user);
+        return GLFW_TRUE;
+    }
+
+    if (_glfw.null.clipboardString &&
+        strcmp(type, "text/plain;charset=utf-8") == 0)
+    {
+        callback(_glfw.null.clipboardString,
+                 strlen(_glfw.null.clipboardString),
+                 user);
+        return GLFW_TRUE;
+    }
+
+    _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                    "Null: Clipboard data not available as %s", type);
+    return GLFW_FALSE;
+}
+
 EGLenum _glfwGetEGLPlatformNull(EGLint** attribs)
 {
     if (_glfw.egl.EXT_platform_base && _glfw.egl.MESA_platform_surfaceless)
@@ -84,10 +84,10 @@ static GLFWglproc getProcAddressGL(const char* procname)
     return proc;
 }
 
-static int extensionSupportedGL(const char* extension)
+static const char* getExtensionStringGL(void)
 {
-    // TODO - Implement this
-    return GLFW_FALSE;
+    // There are no platform extensions
+    return NULL;
 }
 
 static void swapIntervalGL(int interval)
@@ -173,7 +173,7 @@ GLFWbool _glfwCreateContextGL(_GLFWwindow* window,
     window->context.makeCurrent = makeContextCurrentGL;
     window->context.swapBuffers = swapBuffersGL;
     window->context.swapInterval = swapIntervalGL;
-    window->context.extensionSupported = extensionSupportedGL;
+    window->context.getExtensionString = getExtensionStringGL;
     window->context.getProcAddress = getProcAddressGL;
     window->context.destroy = destroyContextGL;
 
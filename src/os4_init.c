@@ -564,6 +564,10 @@ GLFWbool _glfwConnectOS4(int platformID, _GLFWplatform *platform)
             .getKeyScancode = _glfwGetKeyScancodeOS4,
             .setClipboardString = _glfwSetClipboardStringOS4,
             .getClipboardString = _glfwGetClipboardStringOS4,
+            .requestClipboardString = _glfwRequestClipboardStringOS4,
+            .setClipboardData = _glfwSetClipboardDataOS4,
+            .getClipboardTypes = _glfwGetClipboardTypesOS4,
+            .readClipboardData = _glfwReadClipboardDataOS4,
             .initJoysticks = _glfwInitJoysticksOS4,
             .terminateJoysticks = _glfwTerminateJoysticksOS4,
             .pollJoystick = _glfwPollJoystickOS4,
@@ -613,6 +617,7 @@ GLFWbool _glfwConnectOS4(int platformID, _GLFWplatform *platform)
             .pollEvents = _glfwPollEventsOS4,
             .waitEvents = _glfwWaitEventsOS4,
             .waitEventsTimeout = _glfwWaitEventsTimeoutOS4,
+            .waitEventsUntil = _glfwWaitEventsUntilOS4,
             .postEmptyEvent = _glfwPostEmptyEventOS4,
             .getEGLPlatform = _glfwGetEGLPlatformOS4,
             .getEGLNativeDisplay = _glfwGetEGLNativeDisplayOS4,
@@ -253,6 +253,7 @@ int _glfwWindowVisibleOS4(_GLFWwindow* window);
 void _glfwPollEventsOS4(void);
 void _glfwWaitEventsOS4(void);
 void _glfwWaitEventsTimeoutOS4(double timeout);
+void _glfwWaitEventsUntilOS4(uint64_t deadline);
 void _glfwPostEmptyEventOS4(void);
 void _glfwGetCursorPosOS4(_GLFWwindow* window, double* xpos, double* ypos);
 void _glfwSetCursorPosOS4(_GLFWwindow* window, double x, double y);
@@ -263,6 +264,10 @@ void _glfwDestroyCursorOS4(_GLFWcursor* cursor);
 void _glfwSetCursorOS4(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringOS4(const char* string);
 const char* _glfwGetClipboardStringOS4(void);
+void _glfwRequestClipboardStringOS4(void);
+GLFWbool _glfwSetClipboardDataOS4(void);
+const char** _glfwGetClipboardTypesOS4(int* count);
+GLFWbool _glfwReadClipboardDataOS4(const char* type, GLFWclipboarddatafun callback, void* user);
 const char* _glfwGetScancodeNameOS4(int scancode);
 int _glfwGetKeyScancodeOS4(int key);
 
@@ -1080,6 +1080,11 @@ void _glfwWaitEventsTimeoutOS4(double timeout)
     _glfwPollEventsOS4();
 }
 
+void _glfwWaitEventsUntilOS4(uint64_t deadline)
+{
+    _glfwWaitEventsTimeoutOS4(_glfwGetTimeoutUntil(deadline));
+}
+
 void _glfwPostEmptyEventOS4(void)
 {
 }
@@ -1209,6 +1214,34 @@ const char* _glfwGetClipboardStringOS4(void)
     return _glfw.os4.clipboardString;
 }
 
+void _glfwRequestClipboardStringOS4(void)
+{
+    _glfwInputClipboardString(_glfwGetClipboardStringOS4());
+}
+
+GLFWbool _glfwSetClipboardDataOS4(void)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "OS4: Clipboard data not yet implemented");
+    return GLFW_FALSE;
+}
+
+const char** _glfwGetClipboardTypesOS4(int* count)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "OS4: Clipboard data not yet implemented");
+    return NULL;
+}
+
+GLFWbool _glfwReadClipboardDataOS4(const char* type,
+                                   GLFWclipboarddatafun callback,
+                                   void* user)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "OS4: Clipboard data not yet implemented");
+    return GLFW_FALSE;
+}
+
 const char* _glfwGetScancodeNameOS4(int scancode)
 {
     if (scancode < GLFW_KEY_SPACE || scancode > GLFW_KEY_LAST)
@@ -1343,15 +1376,8 @@ OS4_CopyImageData(const GLFWimage *surface)
     dprintf("Copying cursor data %d*%d from surface %p to buffer %p\n", surface->width, surface->height, surface, buffer);
 
     if (buffer) {
-        uint8_t* source = surface->pixels;
-        uint32_t* destination = buffer;
-        int y;
-
-        for (y = 0; y < surface->height; y++) {
-            memcpy(destination, source, bytesPerRow);
-            destination += surface->width;
-            source += 4;
-        }
+        /* The pointer class expects ARGB words */
+        _glfwConvertPixels(buffer, surface->pixels, surface->width * surface->height);
     } else {
         dprintf("Failed to allocate memory\n");
     }
@@ -0,0 +1,388 @@
+//========================================================================
+// GLFW 3.5 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2006-2018 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#include "internal.h"
+
+#include <limits.h>
+
+// The vector kernels treat each output pixel as a little-endian 32-bit word
+// and so are only used on little-endian targets
+//
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+ #define _GLFW_PIXEL_SCALAR_ONLY
+#endif
+
+#if !defined(_GLFW_PIXEL_SCALAR_ONLY)
+ #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define _GLFW_PIXEL_SSE2
+  #include <emmintrin.h>
+ #endif
+ #if defined(__AVX2__)
+  #define _GLFW_PIXEL_AVX2
+  #define _GLFW_PIXEL_AVX2_TARGET
+  #define _GLFW_PIXEL_HAS_AVX2() GLFW_TRUE
+  #include <immintrin.h>
+ #elif defined(_GLFW_PIXEL_SSE2) && defined(__GNUC__) && \
+       (defined(__x86_64__) || defined(__i386__))
+  // The AVX2 kernels are built separately and chosen at run-time
+  #define _GLFW_PIXEL_AVX2
+  #define _GLFW_PIXEL_AVX2_TARGET __attribute__((target("avx2")))
+  #define _GLFW_PIXEL_HAS_AVX2() __builtin_cpu_supports("avx2")
+  #include <immintrin.h>
+ #endif
+ #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+  #define _GLFW_PIXEL_NEON
+  #include <arm_neon.h>
+ #endif
+#endif
+
+// Converts a single RGBA pixel to a native-endian 0xAARRGGBB word
+//
+static uint32_t convertPixel(const unsigned char* source)
+{
+    return ((uint32_t) source[3] << 24) |
+           ((uint32_t) source[0] << 16) |
+           ((uint32_t) source[1] <<  8) |
+           ((uint32_t) source[2] <<  0);
+}
+
+// Converts a single RGBA pixel to a native-endian premultiplied 0xAARRGGBB word
+//
+static uint32_t premultiplyPixel(const unsigned char* source)
+{
+    const unsigned int alpha = source[3];
+
+    return ((uint32_t) alpha << 24) |
+           ((uint32_t) ((source[0] * alpha) / 255) << 16) |
+           ((uint32_t) ((source[1] * alpha) / 255) <<  8) |
+           ((uint32_t) ((source[2] * alpha) / 255) <<  0);
+}
+
+#if defined(_GLFW_PIXEL_SSE2)
+
+// Swaps the red and blue bytes of four RGBA pixels, making 0xAARRGGBB words
+//
+static __m128i swizzleSSE2(__m128i pixels)
+{
+    const __m128i ga = _mm_set1_epi32((int) 0xff00ff00);
+    const __m128i low = _mm_set1_epi32(0xff);
+
+    return _mm_or_si128(_mm_and_si128(pixels, ga),
+                        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(pixels, 16), low),
+                                     _mm_slli_epi32(_mm_and_si128(pixels, low), 16)));
+}
+
+// Multiplies the colors of two pixels widened to 16 bits by their alpha
+//
+static __m128i premultiplyHalfSSE2(__m128i pixels)
+{
+    // The alpha lane is multiplied by 255 instead of by itself
+    const __m128i opaque = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i colors = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i one = _mm_set1_epi16(1);
+
+    __m128i alpha = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_or_si128(_mm_and_si128(alpha, colors), opaque);
+
+    // x / 255 == (x + 1 + (x >> 8)) >> 8 for every product of two bytes
+    const __m128i x = _mm_mullo_epi16(pixels, alpha);
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, one),
+                                        _mm_srli_epi16(x, 8)), 8);
+}
+
+static int convertSSE2(uint32_t* target, const unsigned char* source, int count)
+{
+    int i;
+
+    for (i = 0;  i + 4 <= count;  i += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*) (source + i * 4));
+        _mm_storeu_si128((__m128i*) (target + i), swizzleSSE2(pixels));
+    }
+
+    return i;
+}
+
+static int premultiplySSE2(uint32_t* target, const unsigned char* source, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int i;
+
+    for (i = 0;  i + 4 <= count;  i += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*) (source + i * 4));
+        const __m128i low = premultiplyHalfSSE2(_mm_unpacklo_epi8(pixels, zero));
+        const __m128i high = premultiplyHalfSSE2(_mm_unpackhi_epi8(pixels, zero));
+        _mm_storeu_si128((__m128i*) (target + i),
+                         swizzleSSE2(_mm_packus_epi16(low, high)));
+    }
+
+    return i;
+}
+
+#if ULONG_MAX > 0xffffffffUL
+
+static int widenSSE2(unsigned long* target, const unsigned char* source, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int i;
+
+    for (i = 0;  i + 4 <= count;  i += 4)
+    {
+        const __m128i pixels =
+            swizzleSSE2(_mm_loadu_si128((const __m128i*) (source + i * 4)));
+        _mm_storeu_si128((__m128i*) (target + i), _mm_unpacklo_epi32(pixels, zero));
+        _mm_storeu_si128((__m128i*) (target + i + 2), _mm_unpackhi_epi32(pixels, zero));
+    }
+
+    return i;
+}
+
+#endif // ULONG_MAX
+#endif // _GLFW_PIXEL_SSE2
+
+#if defined(_GLFW_PIXEL_AVX2)
+
+_GLFW_PIXEL_AVX2_TARGET
+static __m256i swizzleAVX2(__m256i pixels)
+{
+    const __m256i ga = _mm256_set1_epi32((int) 0xff00ff00);
+    const __m256i low = _mm256_set1_epi32(0xff);
+
+    return _mm256_or_si256(_mm256_and_si256(pixels, ga),
+                           _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(pixels, 16), low),
+                                           _mm256_slli_epi32(_mm256_and_si256(pixels, low), 16)));
+}
+
+_GLFW_PIXEL_AVX2_TARGET
+static __m256i premultiplyHalfAVX2(__m256i pixels)
+{
+    const __m256i opaque = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0,
+                                            255, 0, 0, 0, 255, 0, 0, 0);
+    const __m256i colors = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1,
+                                            0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i one = _mm256_set1_epi16(1);
+
+    __m256i alpha = _mm256_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_or_si256(_mm256_and_si256(alpha, colors), opaque);
+
+    const __m256i x = _mm256_mullo_epi16(pixels, alpha);
+    return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, one),
+                                              _mm256_srli_epi16(x, 8)), 8);
+}
+
+_GLFW_PIXEL_AVX2_TARGET
+static int convertAVX2(uint32_t* target, const unsigned char* source, int count)
+{
+    int i;
+
+    for (i = 0;  i + 8 <= count;  i += 8)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*) (source + i * 4));
+        _mm256_storeu_si256((__m256i*) (target + i), swizzleAVX2(pixels));
+    }
+
+    return i;
+}
+
+_GLFW_PIXEL_AVX2_TARGET
+static int premultiplyAVX2(uint32_t* target, const unsigned char* source, int count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    int i;
+
+    // The unpack and pack instructions work within each 128-bit lane, so the
+    // pixel order is preserved
+    for (i = 0;  i + 8 <= count;  i += 8)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*) (source + i * 4));
+        const __m256i low = premultiplyHalfAVX2(_mm256_unpacklo_epi8(pixels, zero));
+        const __m256i high = premultiplyHalfAVX2(_mm256_unpackhi_epi8(pixels, zero));
+        _mm256_storeu_si256((__m256i*) (target + i),
+                            swizzleAVX2(_mm256_packus_epi16(low, high)));
+    }
+
+    return i;
+}
+
+#if ULONG_MAX > 0xffffffffUL
+
+_GLFW_PIXEL_AVX2_TARGET
+static int widenAVX2(unsigned long* target, const unsigned char* source, int count)
+{
+    int i;
+
+    for (i = 0;  i + 4 <= count;  i += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*) (source + i * 4));
+        const __m256i words = swizzleAVX2(_mm256_cvtepu32_epi64(pixels));
+        _mm256_storeu_si256((__m256i*) (target + i), words);
+    }
+
+    return i;
+}
+
+#endif // ULONG_MAX
+#endif // _GLFW_PIXEL_AVX2
+
+#if defined(_GLFW_PIXEL_NEON)
+
+static int convertNEON(uint32_t* target, const unsigned char* source, int count)
+{
+    int i;
+
+    for (i = 0;  i + 16 <= count;  i += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8(source + i * 4);
+        const uint8x16_t red = pixels.val[0];
+        pixels.val[0] = pixels.val[2];
+        pixels.val[2] = red;
+        vst4q_u8((uint8_t*) (target + i), pixels);
+    }
+
+    return i;
+}
+
+// Divides the 16-bit products of two bytes by 255 and narrows them to bytes
+//
+static uint8x8_t divideNEON(uint16x8_t x)
+{
+    return vshrn_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+}
+
+static int premultiplyNEON(uint32_t* target, const unsigned char* source, int count)
+{
+    int i;
+
+    for (i = 0;  i + 8 <= count;  i += 8)
+    {
+        const uint8x8x4_t pixels = vld4_u8(source + i * 4);
+        const uint8x8_t alpha = pixels.val[3];
+        uint8x8x4_t result;
+
+        result.val[0] = divideNEON(vmull_u8(pixels.val[2], alpha));
+        result.val[1] = divideNEON(vmull_u8(pixels.val[1], alpha));
+        result.val[2] = divideNEON(vmull_u8(pixels.val[0], alpha));
+        result.val[3] = alpha;
+        vst4_u8((uint8_t*) (target + i), result);
+    }
+
+    return i;
+}
+
+#if ULONG_MAX > 0xffffffffUL
+
+static int widenNEON(unsigned long* target, const unsigned char* source, int count)
+{
+    uint32_t words[16];
+    int i;
+
+    for (i = 0;  i + 16 <= count;  i += 16)
+    {
+        convertNEON(words, source + i * 4, 16);
+
+        for (int j = 0;  j < 16;  j += 4)
+        {
+            const uint32x4_t word = vld1q_u32(words + j);
+            vst1q_u64((uint64_t*) (target + i + j), vmovl_u32(vget_low_u32(word)));
+            vst1q_u64((uint64_t*) (target + i + j + 2), vmovl_u32(vget_high_u32(word)));
+        }
+    }
+
+    return i;
+}
+
+#endif // ULONG_MAX
+#endif // _GLFW_PIXEL_NEON
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Converts RGBA pixels to native-endian 0xAARRGGBB words
+//
+void _glfwConvertPixels(uint32_t* target, const unsigned char* source, int count)
+{
+    int i = 0;
+
+#if defined(_GLFW_PIXEL_AVX2)
+    if (_GLFW_PIXEL_HAS_AVX2())
+        i = convertAVX2(target, source, count);
+#endif
+#if defined(_GLFW_PIXEL_SSE2)
+    i += convertSSE2(target + i, source + i * 4, count - i);
+#elif defined(_GLFW_PIXEL_NEON)
+    i += convertNEON(target + i, source + i * 4, count - i);
+#endif
+
+    for (;  i < count;  i++)
+        target[i] = convertPixel(source + i * 4);
+}
+
+// Converts RGBA pixels to native-endian premultiplied 0xAARRGGBB words
+//
+void _glfwPremultiplyPixels(uint32_t* target, const unsigned char* source, int count)
+{
+    int i = 0;
+
+#if defined(_GLFW_PIXEL_AVX2)
+    if (_GLFW_PIXEL_HAS_AVX2())
+        i = premultiplyAVX2(target, source, count);
+#endif
+#if defined(_GLFW_PIXEL_SSE2)
+    i += premultiplySSE2(target + i, source + i * 4, count - i);
+#elif defined(_GLFW_PIXEL_NEON)
+    i += premultiplyNEON(target + i, source + i * 4, count - i);
+#endif
+
+    for (;  i < count;  i++)
+        target[i] = premultiplyPixel(source + i * 4);
+}
+
+// Converts RGBA pixels to 0xAARRGGBB values in the low 32 bits of longs
+//
+void _glfwWidenPixels(unsigned long* target, const unsigned char* source, int count)
+{
+    int i = 0;
+
+#if ULONG_MAX > 0xffffffffUL
+ #if defined(_GLFW_PIXEL_AVX2)
+    if (_GLFW_PIXEL_HAS_AVX2())
+        i = widenAVX2(target, source, count);
+ #endif
+ #if defined(_GLFW_PIXEL_SSE2)
+    i += widenSSE2(target + i, source + i * 4, count - i);
+ #elif defined(_GLFW_PIXEL_NEON)
+    i += widenNEON(target + i, source + i * 4, count - i);
+ #endif
+#endif // ULONG_MAX
+
+    for (;  i < count;  i++)
+        target[i] = convertPixel(source + i * 4);
+}
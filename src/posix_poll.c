@@ -31,41 +31,148 @@
 #if defined(GLFW_BUILD_POSIX_POLL)
 
 #include <signal.h>
+#include <limits.h>
+#include <string.h>
 #include <time.h>
 #include <errno.h>
 
-GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
+#if defined(__linux__)
+ #include <sys/timerfd.h>
+#endif
+
+// The largest number of file descriptors waited on together with a timer
+#define _GLFW_POLL_TIMER_FD_COUNT 16
+
+#if defined(__linux__)
+
+// Waits until any of the file descriptors are ready or the timer file
+// descriptor reaches the deadline
+// An absolute timerfd expiry is not subject to the timer slack applied to poll
+// timeouts, so the wait ends much closer to the deadline
+//
+static GLFWbool pollWithTimerfd(struct pollfd* fds, nfds_t count,
+                                int timerfd, uint64_t deadline,
+                                GLFWbool* result)
+{
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+    const uint64_t seconds = deadline / frequency;
+    struct pollfd polled[_GLFW_POLL_TIMER_FD_COUNT + 1];
+    struct itimerspec timer = {{0}};
+
+    if (count > _GLFW_POLL_TIMER_FD_COUNT)
+        return GLFW_FALSE;
+
+    timer.it_value.tv_sec = (time_t) (seconds < INT_MAX ? seconds : INT_MAX);
+    timer.it_value.tv_nsec = (long) ((deadline % frequency) * 1000000000 / frequency);
+
+    if (timerfd_settime(timerfd, TFD_TIMER_ABSTIME, &timer, NULL) != 0)
+        return GLFW_FALSE;
+
+    memcpy(polled, fds, count * sizeof(struct pollfd));
+    polled[count] = (struct pollfd) { timerfd, POLLIN };
+
+    *result = _glfwPollPOSIX(polled, count + 1, -1, NULL);
+
+    // Disarming the timer also discards any expiration not yet read
+    memset(&timer, 0, sizeof(timer));
+    timerfd_settime(timerfd, 0, &timer, NULL);
+
+    GLFWbool ready = GLFW_FALSE;
+
+    for (nfds_t i = 0;  i < count;  i++)
+    {
+        fds[i].revents = polled[i].revents;
+        if (fds[i].revents)
+            ready = GLFW_TRUE;
+    }
+
+    if (!ready && polled[count].revents)
+        *result = GLFW_FALSE;
+
+    return GLFW_TRUE;
+}
+
+#endif // __linux__
+
+// Returns the poll events for the specified readiness flags
+//
+static short getPollEvents(int events)
+{
+    short result = 0;
+
+    if (events & GLFW_WAIT_READABLE)
+        result |= POLLIN;
+    if (events & GLFW_WAIT_WRITABLE)
+        result |= POLLOUT;
+
+    return result;
+}
+
+// Returns the readiness flags for the specified returned poll events
+//
+static int getWaitEvents(short revents)
 {
+    int result = 0;
+
+    if (revents & POLLIN)
+        result |= GLFW_WAIT_READABLE;
+    if (revents & POLLOUT)
+        result |= GLFW_WAIT_WRITABLE;
+    if (revents & (POLLERR | POLLHUP | POLLNVAL))
+        result |= GLFW_WAIT_ERROR;
+
+    return result;
+}
+
+GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count,
+                        int timerfd, const uint64_t* deadline)
+{
+#if defined(__linux__)
+    if (deadline && timerfd >= 0 && *deadline > _glfwPlatformGetTimerValue())
+    {
+        GLFWbool result;
+
+        if (pollWithTimerfd(fds, count, timerfd, *deadline, &result))
+            return result;
+    }
+#endif
+
     for (;;)
     {
-        if (timeout)
+        if (deadline)
         {
-            const uint64_t base = _glfwPlatformGetTimerValue();
+            // The remaining time is derived from the fixed deadline before each
+            // attempt, so interrupted polls do not accumulate error
+            const uint64_t now = _glfwPlatformGetTimerValue();
+            const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+            const uint64_t remaining = *deadline > now ? *deadline - now : 0;
 
-#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__CYGWIN__)
-            const time_t seconds = (time_t) *timeout;
-            const long nanoseconds = (long) ((*timeout - seconds) * 1e9);
-            const struct timespec ts = { seconds, nanoseconds };
-            const int result = ppoll(fds, count, &ts, NULL);
-#elif defined(__NetBSD__)
-            const time_t seconds = (time_t) *timeout;
-            const long nanoseconds = (long) ((*timeout - seconds) * 1e9);
-            const struct timespec ts = { seconds, nanoseconds };
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__CYGWIN__) || defined(__NetBSD__)
+            const uint64_t seconds = remaining / frequency;
+            const struct timespec ts =
+            {
+                (time_t) (seconds < INT_MAX ? seconds : INT_MAX),
+                (long) ((remaining % frequency) * 1000000000 / frequency)
+            };
+ #if defined(__NetBSD__)
             const int result = pollts(fds, count, &ts, NULL);
+ #else
+            const int result = ppoll(fds, count, &ts, NULL);
+ #endif
 #else
-            const int milliseconds = (int) (*timeout * 1e3);
-            const int result = poll(fds, count, milliseconds);
+            // Round up so that the poll does not end before the deadline
+            const uint64_t milliseconds = remaining / frequency * 1000 +
+                ((remaining % frequency) * 1000 + frequency - 1) / frequency;
+            const int result = poll(fds, count,
+                                    milliseconds < INT_MAX ? (int) milliseconds : INT_MAX);
 #endif
             const int error = errno; // clock_gettime may overwrite our error
 
-            *timeout -= (_glfwPlatformGetTimerValue() - base) /
-                (double) _glfwPlatformGetTimerFrequency();
-
             if (result > 0)
                 return GLFW_TRUE;
             else if (result == -1 && error != EINTR && error != EAGAIN)
                 return GLFW_FALSE;
-            else if (*timeout <= 0.0)
+            else if (_glfwPlatformGetTimerValue() >= *deadline)
                 return GLFW_FALSE;
         }
         else
@@ -79,5 +186,46 @@ GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
     }
 }
 
+GLFWbool _glfwPollWaitFdsPOSIX(struct pollfd* fds, nfds_t count,
+                               int timerfd, const uint64_t* deadline,
+                               GLFWbool* ready)
+{
+    *ready = GLFW_FALSE;
+
+    if (!_glfw.waitFdCount)
+        return count && _glfwPollPOSIX(fds, count, timerfd, deadline);
+
+    const nfds_t waitCount = (nfds_t) _glfw.waitFdCount;
+    struct pollfd* polled = _glfw_calloc(count + waitCount, sizeof(struct pollfd));
+    if (!polled)
+        return count && _glfwPollPOSIX(fds, count, timerfd, deadline);
+
+    if (count)
+        memcpy(polled, fds, count * sizeof(struct pollfd));
+
+    for (nfds_t i = 0;  i < waitCount;  i++)
+    {
+        polled[count + i].fd = _glfw.waitFds[i].fd;
+        polled[count + i].events = getPollEvents(_glfw.waitFds[i].events);
+    }
+
+    const GLFWbool result = _glfwPollPOSIX(polled, count + waitCount, timerfd, deadline);
+
+    for (nfds_t i = 0;  i < count;  i++)
+        fds[i].revents = result ? polled[i].revents : 0;
+
+    // The callbacks are called later by _glfwInputWaitFds, once the caller is
+    // done with the window system connection
+    for (nfds_t i = 0;  i < waitCount;  i++)
+    {
+        _glfw.waitFds[i].ready = result ? getWaitEvents(polled[count + i].revents) : 0;
+        if (_glfw.waitFds[i].ready)
+            *ready = GLFW_TRUE;
+    }
+
+    _glfw_free(polled);
+    return result;
+}
+
 #endif // GLFW_BUILD_POSIX_POLL
 
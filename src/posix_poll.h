@@ -26,5 +26,9 @@
 
 #include <poll.h>
 
-GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout);
+GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count,
+                        int timerfd, const uint64_t* deadline);
+GLFWbool _glfwPollWaitFdsPOSIX(struct pollfd* fds, nfds_t count,
+                               int timerfd, const uint64_t* deadline,
+                               GLFWbool* ready);
 
@@ -103,5 +103,12 @@ void _glfwPlatformUnlockMutex(_GLFWmutex* mutex)
     pthread_mutex_unlock(&mutex->posix.handle);
 }
 
+void* _glfwPlatformCompareExchangePointer(void* volatile* target,
+                                          void* comparand,
+                                          void* value)
+{
+    return __sync_val_compare_and_swap(target, comparand, value);
+}
+
 #endif // GLFW_BUILD_POSIX_THREAD
 
@@ -323,6 +323,12 @@ static void makeContextCurrentWGL(_GLFWwindow* window)
     }
 }
 
+static GLFWbool isContextCurrentWGL(_GLFWwindow* window)
+{
+    return wglGetCurrentContext() == window->context.wgl.handle &&
+           wglGetCurrentDC() == window->context.wgl.dc;
+}
+
 static void swapBuffersWGL(_GLFWwindow* window)
 {
     if (!window->monitor)
@@ -368,15 +374,19 @@ static void swapIntervalWGL(int interval)
         wglSwapIntervalEXT(interval);
 }
 
-static int extensionSupportedWGL(const char* extension)
+static const char* getExtensionStringWGL(void)
 {
-    const char* extensions = NULL;
-
     if (_glfw.wgl.GetExtensionsStringARB)
-        extensions = wglGetExtensionsStringARB(wglGetCurrentDC());
+        return wglGetExtensionsStringARB(wglGetCurrentDC());
     else if (_glfw.wgl.GetExtensionsStringEXT)
-        extensions = wglGetExtensionsStringEXT();
+        return wglGetExtensionsStringEXT();
+    else
+        return NULL;
+}
 
+static int extensionSupportedWGL(const char* extension)
+{
+    const char* extensions = getExtensionStringWGL();
     if (!extensions)
         return GLFW_FALSE;
 
@@ -762,9 +772,10 @@ GLFWbool _glfwCreateContextWGL(_GLFWwindow* window,
     }
 
     window->context.makeCurrent = makeContextCurrentWGL;
+    window->context.isCurrent = isContextCurrentWGL;
     window->context.swapBuffers = swapBuffersWGL;
     window->context.swapInterval = swapIntervalWGL;
-    window->context.extensionSupported = extensionSupportedWGL;
+    window->context.getExtensionString = getExtensionStringWGL;
     window->context.getProcAddress = getProcAddressWGL;
     window->context.destroy = destroyContextWGL;
 
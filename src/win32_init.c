@@ -618,6 +618,10 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeWin32,
         .setClipboardString = _glfwSetClipboardStringWin32,
         .getClipboardString = _glfwGetClipboardStringWin32,
+        .requestClipboardString = _glfwRequestClipboardStringWin32,
+        .setClipboardData = _glfwSetClipboardDataWin32,
+        .getClipboardTypes = _glfwGetClipboardTypesWin32,
+        .readClipboardData = _glfwReadClipboardDataWin32,
         .initJoysticks = _glfwInitJoysticksWin32,
         .terminateJoysticks = _glfwTerminateJoysticksWin32,
         .pollJoystick = _glfwPollJoystickWin32,
@@ -667,6 +671,7 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         .pollEvents = _glfwPollEventsWin32,
         .waitEvents = _glfwWaitEventsWin32,
         .waitEventsTimeout = _glfwWaitEventsTimeoutWin32,
+        .waitEventsUntil = _glfwWaitEventsUntilWin32,
         .postEmptyEvent = _glfwPostEmptyEventWin32,
         .getEGLPlatform = _glfwGetEGLPlatformWin32,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayWin32,
@@ -582,6 +582,7 @@ GLFWbool _glfwRawMouseMotionSupportedWin32(void);
 void _glfwPollEventsWin32(void);
 void _glfwWaitEventsWin32(void);
 void _glfwWaitEventsTimeoutWin32(double timeout);
+void _glfwWaitEventsUntilWin32(uint64_t deadline);
 void _glfwPostEmptyEventWin32(void);
 
 void _glfwGetCursorPosWin32(_GLFWwindow* window, double* xpos, double* ypos);
@@ -595,6 +596,10 @@ void _glfwDestroyCursorWin32(_GLFWcursor* cursor);
 void _glfwSetCursorWin32(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringWin32(const char* string);
 const char* _glfwGetClipboardStringWin32(void);
+void _glfwRequestClipboardStringWin32(void);
+GLFWbool _glfwSetClipboardDataWin32(void);
+const char** _glfwGetClipboardTypesWin32(int* count);
+GLFWbool _glfwReadClipboardDataWin32(const char* type, GLFWclipboarddatafun callback, void* user);
 
 EGLenum _glfwGetEGLPlatformWin32(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayWin32(void);
@@ -96,5 +96,12 @@ void _glfwPlatformUnlockMutex(_GLFWmutex* mutex)
     LeaveCriticalSection(&mutex->win32.section);
 }
 
+void* _glfwPlatformCompareExchangePointer(void* volatile* target,
+                                          void* comparand,
+                                          void* value)
+{
+    return InterlockedCompareExchangePointer(target, value, comparand);
+}
+
 #endif // GLFW_BUILD_WIN32_THREAD
 
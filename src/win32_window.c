@@ -100,14 +100,12 @@ static const GLFWimage* chooseImage(int count, const GLFWimage* images,
 //
 static HICON createIcon(const GLFWimage* image, int xhot, int yhot, GLFWbool icon)
 {
-    int i;
     HDC dc;
     HICON handle;
     HBITMAP color, mask;
     BITMAPV5HEADER bi;
     ICONINFO ii;
-    unsigned char* target = NULL;
-    unsigned char* source = image->pixels;
+    uint32_t* target = NULL;
 
     ZeroMemory(&bi, sizeof(bi));
     bi.bV5Size        = sizeof(bi);
@@ -146,15 +144,7 @@ static HICON createIcon(const GLFWimage* image, int xhot, int yhot, GLFWbool ico
         return NULL;
     }
 
-    for (i = 0;  i < image->width * image->height;  i++)
-    {
-        target[0] = source[2];
-        target[1] = source[1];
-        target[2] = source[0];
-        target[3] = source[3];
-        target += 4;
-        source += 4;
-    }
+    _glfwConvertPixels(target, image->pixels, image->width * image->height);
 
     ZeroMemory(&ii, sizeof(ii));
     ii.fIcon    = icon;
@@ -2196,6 +2186,11 @@ void _glfwWaitEventsTimeoutWin32(double timeout)
     _glfwPollEventsWin32();
 }
 
+void _glfwWaitEventsUntilWin32(uint64_t deadline)
+{
+    _glfwWaitEventsTimeoutWin32(_glfwGetTimeoutUntil(deadline));
+}
+
 void _glfwPostEmptyEventWin32(void)
 {
     PostMessageW(_glfw.win32.helperWindowHandle, WM_NULL, 0, 0);
@@ -2463,6 +2458,34 @@ const char* _glfwGetClipboardStringWin32(void)
     return _glfw.win32.clipboardString;
 }
 
+void _glfwRequestClipboardStringWin32(void)
+{
+    _glfwInputClipboardString(_glfwGetClipboardStringWin32());
+}
+
+GLFWbool _glfwSetClipboardDataWin32(void)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "Win32: Clipboard data not yet implemented");
+    return GLFW_FALSE;
+}
+
+const char** _glfwGetClipboardTypesWin32(int* count)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "Win32: Clipboard data not yet implemented");
+    return NULL;
+}
+
+GLFWbool _glfwReadClipboardDataWin32(const char* type,
+                                     GLFWclipboarddatafun callback,
+                                     void* user)
+{
+    _glfwInputError(GLFW_FEATURE_UNIMPLEMENTED,
+                    "Win32: Clipboard data not yet implemented");
+    return GLFW_FALSE;
+}
+
 EGLenum _glfwGetEGLPlatformWin32(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
@@ -173,6 +173,32 @@ void _glfwInputWindowMonitor(_GLFWwindow* window, _GLFWmonitor* monitor)
     window->monitor = monitor;
 }
 
+// Notifies shared code of the wait file descriptors found ready by the last
+// wait of the platform
+//
+void _glfwInputWaitFds(void)
+{
+    // Callbacks may add and remove wait file descriptors, so the wait set is
+    // searched again after every call
+    for (;;)
+    {
+        int i;
+
+        for (i = 0;  i < _glfw.waitFdCount;  i++)
+        {
+            if (_glfw.waitFds[i].ready)
+                break;
+        }
+
+        if (i == _glfw.waitFdCount)
+            break;
+
+        const _GLFWwaitfd entry = _glfw.waitFds[i];
+        _glfw.waitFds[i].ready = 0;
+        entry.callback(entry.fd, entry.ready, entry.user);
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW public API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -264,6 +290,9 @@ void glfwDefaultWindowHints(void)
     _glfw.hints.context.major  = 1;
     _glfw.hints.context.minor  = 0;
 
+    // The default is to have up to three frames in flight when reading back
+    _glfw.hints.context.readbackBuffers = 3;
+
     // The default is a focused, visible, resizable window with decorations
     memset(&_glfw.hints.window, 0, sizeof(_glfw.hints.window));
     _glfw.hints.window.resizable    = GLFW_TRUE;
@@ -428,6 +457,9 @@ GLFWAPI void glfwWindowHint(int hint, int value)
         case GLFW_CONTEXT_RELEASE_BEHAVIOR:
             _glfw.hints.context.release = value;
             return;
+        case GLFW_READBACK_BUFFERS:
+            _glfw.hints.context.readbackBuffers = value;
+            return;
         case GLFW_REFRESH_RATE:
             _glfw.hints.refreshRate = value;
             return;
@@ -478,6 +510,9 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
     // Clear all callbacks to avoid exposing a half torn-down window object
     memset(&window->callbacks, 0, sizeof(window->callbacks));
 
+    // Frames still being read back are discarded
+    _glfwFreeReadback(window);
+
     // The window's context must not be current on another thread when the
     // window is destroyed
     if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
@@ -495,6 +530,11 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
         *prev = window->next;
     }
 
+    _glfwReleaseProcCache(window);
+    _glfw_free(window->context.extensionNames);
+    _glfw_free(window->context.extensionIndex);
+    _glfw_free(window->queue.events);
+    _glfw_free(window->motion.history);
     _glfw_free(window->title);
     _glfw_free(window);
 }
@@ -1167,13 +1207,17 @@ GLFWAPI GLFWwindowcontentscalefun glfwSetWindowContentScaleCallback(GLFWwindow*
 GLFWAPI void glfwPollEvents(void)
 {
     _GLFW_REQUIRE_INIT();
+    _glfwBeginEventProcessing();
     _glfw.platform.pollEvents();
+    _glfwEndEventProcessing();
 }
 
 GLFWAPI void glfwWaitEvents(void)
 {
     _GLFW_REQUIRE_INIT();
+    _glfwBeginEventProcessing();
     _glfw.platform.waitEvents();
+    _glfwEndEventProcessing();
 }
 
 GLFWAPI void glfwWaitEventsTimeout(double timeout)
@@ -1189,7 +1233,93 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout)
         return;
     }
 
+    _glfwBeginEventProcessing();
     _glfw.platform.waitEventsTimeout(timeout);
+    _glfwEndEventProcessing();
+}
+
+GLFWAPI void glfwWaitEventsUntil(uint64_t deadline)
+{
+    _GLFW_REQUIRE_INIT();
+    _glfwBeginEventProcessing();
+    _glfw.platform.waitEventsUntil(deadline);
+    _glfwEndEventProcessing();
+}
+
+GLFWAPI int glfwAddWaitFd(int fd, int events, GLFWwaitfdfun callback, void* user)
+{
+    int i;
+    _GLFWwaitfd* entry = NULL;
+
+    assert(callback != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    if (fd < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid file descriptor %i", fd);
+        return GLFW_FALSE;
+    }
+
+    if (!events || (events & ~(GLFW_WAIT_READABLE | GLFW_WAIT_WRITABLE)))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid wait events 0x%08X", events);
+        return GLFW_FALSE;
+    }
+
+    if (_glfw.platform.platformID != GLFW_PLATFORM_X11 &&
+        _glfw.platform.platformID != GLFW_PLATFORM_WAYLAND)
+    {
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "Event processing does not wait on file descriptors on this platform");
+        return GLFW_FALSE;
+    }
+
+    for (i = 0;  i < _glfw.waitFdCount;  i++)
+    {
+        if (_glfw.waitFds[i].fd == fd)
+        {
+            entry = _glfw.waitFds + i;
+            break;
+        }
+    }
+
+    if (!entry)
+    {
+        _GLFWwaitfd* waitFds =
+            _glfw_realloc(_glfw.waitFds, sizeof(_GLFWwaitfd) * (_glfw.waitFdCount + 1));
+        if (!waitFds)
+            return GLFW_FALSE;
+
+        _glfw.waitFds = waitFds;
+        entry = _glfw.waitFds + _glfw.waitFdCount;
+        entry->ready = 0;
+        _glfw.waitFdCount++;
+    }
+
+    entry->fd = fd;
+    entry->events = events;
+    entry->callback = callback;
+    entry->user = user;
+    return GLFW_TRUE;
+}
+
+GLFWAPI void glfwRemoveWaitFd(int fd)
+{
+    int i;
+
+    _GLFW_REQUIRE_INIT();
+
+    for (i = 0;  i < _glfw.waitFdCount;  i++)
+    {
+        if (_glfw.waitFds[i].fd == fd)
+        {
+            _glfw.waitFdCount--;
+            memmove(_glfw.waitFds + i, _glfw.waitFds + i + 1,
+                    sizeof(_GLFWwaitfd) * (_glfw.waitFdCount - i));
+            break;
+        }
+    }
 }
 
 GLFWAPI void glfwPostEmptyEvent(void)
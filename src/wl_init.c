@@ -452,6 +452,10 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeWayland,
         .setClipboardString = _glfwSetClipboardStringWayland,
         .getClipboardString = _glfwGetClipboardStringWayland,
+        .requestClipboardString = _glfwRequestClipboardStringWayland,
+        .setClipboardData = _glfwSetClipboardDataWayland,
+        .getClipboardTypes = _glfwGetClipboardTypesWayland,
+        .readClipboardData = _glfwReadClipboardDataWayland,
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
         .initJoysticks = _glfwInitJoysticksLinux,
         .terminateJoysticks = _glfwTerminateJoysticksLinux,
@@ -509,6 +513,7 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         .pollEvents = _glfwPollEventsWayland,
         .waitEvents = _glfwWaitEventsWayland,
         .waitEventsTimeout = _glfwWaitEventsTimeoutWayland,
+        .waitEventsUntil = _glfwWaitEventsUntilWayland,
         .postEmptyEvent = _glfwPostEmptyEventWayland,
         .getEGLPlatform = _glfwGetEGLPlatformWayland,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayWayland,
@@ -566,6 +571,7 @@ int _glfwInitWayland(void)
     // These must be set before any failure checks
     _glfw.wl.keyRepeatTimerfd = -1;
     _glfw.wl.cursorTimerfd = -1;
+    _glfw.wl.waitTimerfd = -1;
 
     _glfw.wl.tag = glfwGetVersionString();
 
@@ -889,6 +895,8 @@ int _glfwInitWayland(void)
         _glfwAddDataDeviceListenerWayland(_glfw.wl.dataDevice);
     }
 
+    _glfw.wl.waitTimerfd = timerfd_create(_glfw.timer.posix.clock,
+                                          TFD_CLOEXEC | TFD_NONBLOCK);
     return GLFW_TRUE;
 }
 
@@ -944,16 +952,30 @@ void _glfwTerminateWayland(void)
     }
 
     for (unsigned int i = 0; i < _glfw.wl.offerCount; i++)
+    {
         wl_data_offer_destroy(_glfw.wl.offers[i].offer);
 
+        for (unsigned int j = 0; j < _glfw.wl.offers[i].typeCount; j++)
+            _glfw_free(_glfw.wl.offers[i].types[j]);
+
+        _glfw_free(_glfw.wl.offers[i].types);
+    }
+
     _glfw_free(_glfw.wl.offers);
 
+    for (unsigned int i = 0; i < _glfw.wl.selectionTypeCount; i++)
+        _glfw_free(_glfw.wl.selectionTypes[i]);
+
+    _glfw_free(_glfw.wl.selectionTypes);
+
     if (_glfw.wl.cursorSurface)
         wl_surface_destroy(_glfw.wl.cursorSurface);
     if (_glfw.wl.subcompositor)
         wl_subcompositor_destroy(_glfw.wl.subcompositor);
     if (_glfw.wl.compositor)
         wl_compositor_destroy(_glfw.wl.compositor);
+    _glfwTerminateShmPoolWayland();
+
     if (_glfw.wl.shm)
         wl_shm_destroy(_glfw.wl.shm);
     if (_glfw.wl.viewporter)
@@ -1000,6 +1022,8 @@ void _glfwTerminateWayland(void)
         close(_glfw.wl.keyRepeatTimerfd);
     if (_glfw.wl.cursorTimerfd >= 0)
         close(_glfw.wl.cursorTimerfd);
+    if (_glfw.wl.waitTimerfd >= 0)
+        close(_glfw.wl.waitTimerfd);
 
     _glfw_free(_glfw.wl.clipboardString);
 }
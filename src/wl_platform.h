@@ -333,11 +333,40 @@ typedef struct _GLFWfallbackEdgeWayland
     struct wp_viewport*         viewport;
 } _GLFWfallbackEdgeWayland;
 
+// A region of the shared memory pool and the buffer currently made from it
+//
+typedef struct _GLFWshmBlockWayland
+{
+    struct _GLFWshmBlockWayland* next;
+    struct wl_buffer*           buffer;
+    int32_t                     offset;
+    int32_t                     capacity;
+    int                         width, height;
+    // Whether the block is owned by a cursor or window
+    GLFWbool                    used;
+    // Whether the buffer is attached and has not yet been released
+    GLFWbool                    busy;
+} _GLFWshmBlockWayland;
+
+// The shared memory pool that cursor and decoration buffers are allocated from
+//
+typedef struct _GLFWshmPoolWayland
+{
+    struct wl_shm_pool*         pool;
+    int                         fd;
+    unsigned char*              data;
+    int32_t                     size;
+    int32_t                     tail;
+    _GLFWshmBlockWayland*       blocks;
+} _GLFWshmPoolWayland;
+
 typedef struct _GLFWofferWayland
 {
     struct wl_data_offer*       offer;
     GLFWbool                    text_plain_utf8;
     GLFWbool                    text_uri_list;
+    char**                      types;
+    unsigned int                typeCount;
 } _GLFWofferWayland;
 
 typedef struct _GLFWscaleWayland
@@ -425,6 +454,7 @@ typedef struct _GLFWlibraryWayland
     struct wl_compositor*       compositor;
     struct wl_subcompositor*    subcompositor;
     struct wl_shm*              shm;
+    _GLFWshmPoolWayland         shmPool;
     struct wl_seat*             seat;
     struct wl_pointer*          pointer;
     struct wl_keyboard*         keyboard;
@@ -444,6 +474,9 @@ typedef struct _GLFWlibraryWayland
 
     struct wl_data_offer*       selectionOffer;
     struct wl_data_source*      selectionSource;
+    // MIME types of the current selection offer
+    char**                      selectionTypes;
+    unsigned int                selectionTypeCount;
 
     struct wl_data_offer*       dragOffer;
     _GLFWwindow*                dragFocus;
@@ -456,6 +489,8 @@ typedef struct _GLFWlibraryWayland
     struct wl_surface*          cursorSurface;
     const char*                 cursorPreviousName;
     int                         cursorTimerfd;
+    // Timer for waiting until an event processing deadline
+    int                         waitTimerfd;
     uint32_t                    serial;
     uint32_t                    pointerEnterSerial;
 
@@ -655,6 +690,7 @@ GLFWbool _glfwRawMouseMotionSupportedWayland(void);
 void _glfwPollEventsWayland(void);
 void _glfwWaitEventsWayland(void);
 void _glfwWaitEventsTimeoutWayland(double timeout);
+void _glfwWaitEventsUntilWayland(uint64_t deadline);
 void _glfwPostEmptyEventWayland(void);
 
 void _glfwGetCursorPosWayland(_GLFWwindow* window, double* xpos, double* ypos);
@@ -668,6 +704,10 @@ void _glfwDestroyCursorWayland(_GLFWcursor* cursor);
 void _glfwSetCursorWayland(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringWayland(const char* string);
 const char* _glfwGetClipboardStringWayland(void);
+void _glfwRequestClipboardStringWayland(void);
+GLFWbool _glfwSetClipboardDataWayland(void);
+const char** _glfwGetClipboardTypesWayland(int* count);
+GLFWbool _glfwReadClipboardDataWayland(const char* type, GLFWclipboarddatafun callback, void* user);
 
 EGLenum _glfwGetEGLPlatformWayland(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayWayland(void);
@@ -688,6 +728,7 @@ void _glfwSetGammaRampWayland(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
 
 void _glfwAddOutputWayland(uint32_t name, uint32_t version);
 void _glfwUpdateBufferScaleFromOutputsWayland(_GLFWwindow* window);
+void _glfwTerminateShmPoolWayland(void);
 
 void _glfwAddSeatListenerWayland(struct wl_seat* seat);
 void _glfwAddDataDeviceListenerWayland(struct wl_data_device* device);
@@ -66,6 +66,18 @@ static int createTmpfileCloexec(char* tmpname)
     return fd;
 }
 
+// Sets the size of the anonymous file, which may only grow if it is sealed
+//
+static int allocateAnonymousFile(int fd, off_t size)
+{
+#if defined(SHM_ANON)
+    // posix_fallocate does not work on SHM descriptors
+    return ftruncate(fd, size) == 0 ? 0 : errno;
+#else
+    return posix_fallocate(fd, 0, size);
+#endif
+}
+
 /*
  * Create a new, unique, anonymous file of the given size, and
  * return the file descriptor for it. The file descriptor is set
@@ -128,12 +140,7 @@ static int createAnonymousFile(off_t size)
             return -1;
     }
 
-#if defined(SHM_ANON)
-    // posix_fallocate does not work on SHM descriptors
-    ret = ftruncate(fd, size);
-#else
-    ret = posix_fallocate(fd, 0, size);
-#endif
+    ret = allocateAnonymousFile(fd, size);
     if (ret != 0)
     {
         close(fd);
@@ -143,54 +150,183 @@ static int createAnonymousFile(off_t size)
     return fd;
 }
 
-static struct wl_buffer* createShmBuffer(const GLFWimage* image)
+static void bufferHandleRelease(void* userData, struct wl_buffer* buffer)
 {
-    const int stride = image->width * 4;
-    const int length = image->width * image->height * 4;
+    _GLFWshmBlockWayland* block = userData;
+    block->busy = GLFW_FALSE;
+}
 
-    const int fd = createAnonymousFile(length);
-    if (fd < 0)
+static const struct wl_buffer_listener bufferListener =
+{
+    bufferHandleRelease
+};
+
+// Grows the shared memory pool to at least the specified size
+//
+static GLFWbool growShmPool(int32_t size)
+{
+    _GLFWshmPoolWayland* shm = &_glfw.wl.shmPool;
+    int32_t newSize = _glfw_max(shm->size * 2, 65536);
+
+    while (newSize < size)
+        newSize *= 2;
+
+    if (!shm->pool)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "Wayland: Failed to create buffer file of size %d: %s",
-                        length, strerror(errno));
-        return NULL;
+        shm->fd = createAnonymousFile(newSize);
+        if (shm->fd < 0)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Wayland: Failed to create buffer file of size %d: %s",
+                            newSize, strerror(errno));
+            return GLFW_FALSE;
+        }
+    }
+    else
+    {
+        const int result = allocateAnonymousFile(shm->fd, newSize);
+        if (result != 0)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Wayland: Failed to grow buffer file to size %d: %s",
+                            newSize, strerror(result));
+            return GLFW_FALSE;
+        }
     }
 
-    void* data = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    void* data = mmap(NULL, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, shm->fd, 0);
     if (data == MAP_FAILED)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "Wayland: Failed to map file: %s", strerror(errno));
-        close(fd);
-        return NULL;
+
+        if (!shm->pool)
+            close(shm->fd);
+
+        return GLFW_FALSE;
     }
 
-    struct wl_shm_pool* pool = wl_shm_create_pool(_glfw.wl.shm, fd, length);
+    if (shm->pool)
+    {
+        munmap(shm->data, shm->size);
+        wl_shm_pool_resize(shm->pool, newSize);
+    }
+    else
+        shm->pool = wl_shm_create_pool(_glfw.wl.shm, shm->fd, newSize);
 
-    close(fd);
+    shm->data = data;
+    shm->size = newSize;
+    return GLFW_TRUE;
+}
+
+// Returns a buffer from the shared memory pool holding the specified image
+//
+static struct wl_buffer* createShmBuffer(const GLFWimage* image)
+{
+    _GLFWshmPoolWayland* shm = &_glfw.wl.shmPool;
+    _GLFWshmBlockWayland* block = NULL;
+    const int stride = image->width * 4;
+    const int length = image->width * image->height * 4;
+
+    // Prefer an idle block with a buffer of the right size, then any idle block
+    // large enough, before growing the pool
+    for (_GLFWshmBlockWayland* entry = shm->blocks;  entry;  entry = entry->next)
+    {
+        if (entry->used || entry->busy || entry->capacity < length)
+            continue;
+
+        if (entry->width == image->width && entry->height == image->height)
+        {
+            block = entry;
+            break;
+        }
+
+        if (!block || entry->capacity < block->capacity)
+            block = entry;
+    }
+
+    if (!block)
+    {
+        if (shm->tail + length > shm->size)
+        {
+            if (!growShmPool(shm->tail + length))
+                return NULL;
+        }
+
+        block = _glfw_calloc(1, sizeof(_GLFWshmBlockWayland));
+        if (!block)
+            return NULL;
+
+        block->offset = shm->tail;
+        block->capacity = length;
+        block->next = shm->blocks;
+        shm->blocks = block;
+        shm->tail += length;
+    }
 
-    unsigned char* source = (unsigned char*) image->pixels;
-    unsigned char* target = data;
-    for (int i = 0;  i < image->width * image->height;  i++, source += 4)
+    if (block->width != image->width || block->height != image->height)
     {
-        unsigned int alpha = source[3];
+        if (block->buffer)
+            wl_buffer_destroy(block->buffer);
 
-        *target++ = (unsigned char) ((source[2] * alpha) / 255);
-        *target++ = (unsigned char) ((source[1] * alpha) / 255);
-        *target++ = (unsigned char) ((source[0] * alpha) / 255);
-        *target++ = (unsigned char) alpha;
+        block->buffer = wl_shm_pool_create_buffer(shm->pool, block->offset,
+                                                  image->width,
+                                                  image->height,
+                                                  stride, WL_SHM_FORMAT_ARGB8888);
+        wl_buffer_add_listener(block->buffer, &bufferListener, block);
+        block->width = image->width;
+        block->height = image->height;
     }
 
-    struct wl_buffer* buffer =
-        wl_shm_pool_create_buffer(pool, 0,
-                                  image->width,
-                                  image->height,
-                                  stride, WL_SHM_FORMAT_ARGB8888);
-    munmap(data, length);
-    wl_shm_pool_destroy(pool);
+    _glfwPremultiplyPixels((uint32_t*) (shm->data + block->offset),
+                           image->pixels,
+                           image->width * image->height);
 
-    return buffer;
+    block->used = GLFW_TRUE;
+    return block->buffer;
+}
+
+// Returns a buffer to the shared memory pool, to be reused once the compositor
+// has released it
+//
+static void destroyShmBuffer(struct wl_buffer* buffer)
+{
+    _GLFWshmBlockWayland* block = wl_buffer_get_user_data(buffer);
+    block->used = GLFW_FALSE;
+}
+
+// Attaches a buffer from the shared memory pool to the specified surface
+//
+static void attachShmBuffer(struct wl_surface* surface, struct wl_buffer* buffer)
+{
+    _GLFWshmBlockWayland* block = wl_buffer_get_user_data(buffer);
+    block->busy = GLFW_TRUE;
+    wl_surface_attach(surface, buffer, 0, 0);
+}
+
+void _glfwTerminateShmPoolWayland(void)
+{
+    _GLFWshmPoolWayland* shm = &_glfw.wl.shmPool;
+
+    while (shm->blocks)
+    {
+        _GLFWshmBlockWayland* next = shm->blocks->next;
+
+        if (shm->blocks->buffer)
+            wl_buffer_destroy(shm->blocks->buffer);
+
+        _glfw_free(shm->blocks);
+        shm->blocks = next;
+    }
+
+    if (shm->pool)
+    {
+        wl_shm_pool_destroy(shm->pool);
+        munmap(shm->data, shm->size);
+        close(shm->fd);
+    }
+
+    memset(shm, 0, sizeof(_GLFWshmPoolWayland));
 }
 
 static void createFallbackEdge(_GLFWwindow* window,
@@ -209,7 +345,7 @@ static void createFallbackEdge(_GLFWwindow* window,
     edge->viewport = wp_viewporter_get_viewport(_glfw.wl.viewporter,
                                                 edge->surface);
     wp_viewport_set_destination(edge->viewport, width, height);
-    wl_surface_attach(edge->surface, buffer, 0, 0);
+    attachShmBuffer(edge->surface, buffer);
 
     struct wl_region* region = wl_compositor_create_region(_glfw.wl.compositor);
     wl_region_add(region, 0, 0, width, height);
@@ -1115,7 +1251,12 @@ static void setCursorImage(_GLFWwindow* window,
                           cursorWayland->xhot / scale,
                           cursorWayland->yhot / scale);
     wl_surface_set_buffer_scale(surface, scale);
-    wl_surface_attach(surface, buffer, 0, 0);
+
+    if (wlCursor)
+        wl_surface_attach(surface, buffer, 0, 0);
+    else
+        attachShmBuffer(surface, buffer);
+
     wl_surface_damage(surface, 0, 0,
                       cursorWayland->width, cursorWayland->height);
     wl_surface_commit(surface);
@@ -1202,31 +1343,39 @@ static void inputText(_GLFWwindow* window, uint32_t scancode)
     }
 }
 
-static void handleEvents(double* timeout)
+static void handleEvents(const uint64_t* deadline)
 {
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
+        _glfwProcessJoystickEventsLinux();
 #endif
 
     GLFWbool event = GLFW_FALSE;
-    enum { DISPLAY_FD, KEYREPEAT_FD, CURSOR_FD, LIBDECOR_FD };
+    enum { DISPLAY_FD, KEYREPEAT_FD, CURSOR_FD, LIBDECOR_FD, JOYSTICK_FD };
     struct pollfd fds[] =
     {
         [DISPLAY_FD] = { wl_display_get_fd(_glfw.wl.display), POLLIN },
         [KEYREPEAT_FD] = { _glfw.wl.keyRepeatTimerfd, POLLIN },
         [CURSOR_FD] = { _glfw.wl.cursorTimerfd, POLLIN },
-        [LIBDECOR_FD] = { -1, POLLIN }
+        [LIBDECOR_FD] = { -1, POLLIN },
+        [JOYSTICK_FD] = { -1, POLLIN }
     };
 
     if (_glfw.wl.libdecor.context)
         fds[LIBDECOR_FD].fd = libdecor_get_fd(_glfw.wl.libdecor.context);
 
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+    if (_glfw.joysticksInitialized)
+        fds[JOYSTICK_FD].fd = _glfw.linjs.epoll;
+#endif
+
     while (!event)
     {
         while (wl_display_prepare_read(_glfw.wl.display) != 0)
         {
-            if (wl_display_dispatch_pending(_glfw.wl.display) > 0)
+            const int count = wl_display_dispatch_pending(_glfw.wl.display);
+            _glfwInputEventTime(0);
+            if (count > 0)
                 return;
         }
 
@@ -1246,7 +1395,10 @@ static void handleEvents(double* timeout)
             return;
         }
 
-        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), timeout))
+        GLFWbool ready;
+
+        if (!_glfwPollWaitFdsPOSIX(fds, sizeof(fds) / sizeof(fds[0]),
+                                   _glfw.wl.waitTimerfd, deadline, &ready))
         {
             wl_display_cancel_read(_glfw.wl.display);
             return;
@@ -1257,10 +1409,19 @@ static void handleEvents(double* timeout)
             wl_display_read_events(_glfw.wl.display);
             if (wl_display_dispatch_pending(_glfw.wl.display) > 0)
                 event = GLFW_TRUE;
+
+            _glfwInputEventTime(0);
         }
         else
             wl_display_cancel_read(_glfw.wl.display);
 
+        // The read must be finished before the callbacks may use the display
+        if (ready)
+        {
+            _glfwInputWaitFds();
+            event = GLFW_TRUE;
+        }
+
         if (fds[KEYREPEAT_FD].revents & POLLIN)
         {
             uint64_t repeats;
@@ -1294,6 +1455,14 @@ static void handleEvents(double* timeout)
             if (libdecor_dispatch(_glfw.wl.libdecor.context, 0) > 0)
                 event = GLFW_TRUE;
         }
+
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+        if (fds[JOYSTICK_FD].revents & POLLIN)
+        {
+            _glfwProcessJoystickEventsLinux();
+            event = GLFW_TRUE;
+        }
+#endif
     }
 }
 
@@ -1368,6 +1537,9 @@ static void pointerHandleEnter(void* userData,
                                wl_fixed_t sx,
                                wl_fixed_t sy)
 {
+    // This event has no timestamp of its own
+    _glfwInputEventTime(0);
+
     // Happens in the case we just destroyed the surface.
     if (!surface)
         return;
@@ -1399,6 +1571,9 @@ static void pointerHandleLeave(void* userData,
                                uint32_t serial,
                                struct wl_surface* surface)
 {
+    // This event has no timestamp of its own
+    _glfwInputEventTime(0);
+
     if (!surface)
         return;
 
@@ -1431,6 +1606,8 @@ static void pointerHandleMotion(void* userData,
                                 wl_fixed_t sx,
                                 wl_fixed_t sy)
 {
+    _glfwInputEventTime(_glfwConvertEventTime(time));
+
     _GLFWwindow* window = _glfw.wl.pointerFocus;
     if (!window)
         return;
@@ -1534,6 +1711,8 @@ static void pointerHandleButton(void* userData,
                                 uint32_t button,
                                 uint32_t state)
 {
+    _glfwInputEventTime(_glfwConvertEventTime(time));
+
     _GLFWwindow* window = _glfw.wl.pointerFocus;
     if (!window)
         return;
@@ -1611,6 +1790,8 @@ static void pointerHandleAxis(void* userData,
                               uint32_t axis,
                               wl_fixed_t value)
 {
+    _glfwInputEventTime(_glfwConvertEventTime(time));
+
     _GLFWwindow* window = _glfw.wl.pointerFocus;
     if (!window)
         return;
@@ -1769,6 +1950,8 @@ static void keyboardHandleKey(void* userData,
                               uint32_t scancode,
                               uint32_t state)
 {
+    _glfwInputEventTime(_glfwConvertEventTime(time));
+
     _GLFWwindow* window = _glfw.wl.keyboardFocus;
     if (!window)
         return;
@@ -1916,18 +2099,40 @@ static const struct wl_seat_listener seatListener =
     seatHandleName,
 };
 
+// Frees the specified list of offered MIME types
+//
+static void freeOfferTypes(char** types, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++)
+        _glfw_free(types[i]);
+
+    _glfw_free(types);
+}
+
 static void dataOfferHandleOffer(void* userData,
                                  struct wl_data_offer* offer,
                                  const char* mimeType)
 {
     for (unsigned int i = 0; i < _glfw.wl.offerCount; i++)
     {
-        if (_glfw.wl.offers[i].offer == offer)
+        _GLFWofferWayland* entry = _glfw.wl.offers + i;
+
+        if (entry->offer == offer)
         {
             if (strcmp(mimeType, "text/plain;charset=utf-8") == 0)
-                _glfw.wl.offers[i].text_plain_utf8 = GLFW_TRUE;
+                entry->text_plain_utf8 = GLFW_TRUE;
             else if (strcmp(mimeType, "text/uri-list") == 0)
-                _glfw.wl.offers[i].text_uri_list = GLFW_TRUE;
+                entry->text_uri_list = GLFW_TRUE;
+
+            char** types = _glfw_realloc(entry->types,
+                                         sizeof(char*) * (entry->typeCount + 1));
+            if (!types)
+                break;
+
+            entry->types = types;
+            entry->types[entry->typeCount] = _glfw_strdup(mimeType);
+            if (entry->types[entry->typeCount])
+                entry->typeCount++;
 
             break;
         }
@@ -2007,6 +2212,8 @@ static void dataDeviceHandleEnter(void* userData,
         wl_data_offer_destroy(offer);
     }
 
+    freeOfferTypes(_glfw.wl.offers[i].types, _glfw.wl.offers[i].typeCount);
+
     _glfw.wl.offers[i] = _glfw.wl.offers[_glfw.wl.offerCount - 1];
     _glfw.wl.offerCount--;
 }
@@ -2065,12 +2272,21 @@ static void dataDeviceHandleSelection(void* userData,
         _glfw.wl.selectionOffer = NULL;
     }
 
+    freeOfferTypes(_glfw.wl.selectionTypes, _glfw.wl.selectionTypeCount);
+    _glfw.wl.selectionTypes = NULL;
+    _glfw.wl.selectionTypeCount = 0;
+
     for (unsigned int i = 0; i < _glfw.wl.offerCount; i++)
     {
         if (_glfw.wl.offers[i].offer == offer)
         {
-            if (_glfw.wl.offers[i].text_plain_utf8)
+            // The offer is kept for glfwReadClipboardData whatever its types
+            if (_glfw.wl.offers[i].typeCount)
+            {
                 _glfw.wl.selectionOffer = offer;
+                _glfw.wl.selectionTypes = _glfw.wl.offers[i].types;
+                _glfw.wl.selectionTypeCount = _glfw.wl.offers[i].typeCount;
+            }
             else
                 wl_data_offer_destroy(offer);
 
@@ -2212,7 +2428,7 @@ void _glfwDestroyWindowWayland(_GLFWwindow* window)
     destroyShellObjects(window);
 
     if (window->wl.fallback.buffer)
-        wl_buffer_destroy(window->wl.fallback.buffer);
+        destroyShmBuffer(window->wl.fallback.buffer);
 
     if (window->wl.egl.window)
         wl_egl_window_destroy(window->wl.egl.window);
@@ -2645,8 +2861,8 @@ GLFWbool _glfwRawMouseMotionSupportedWayland(void)
 
 void _glfwPollEventsWayland(void)
 {
-    double timeout = 0.0;
-    handleEvents(&timeout);
+    const uint64_t deadline = 0;
+    handleEvents(&deadline);
 }
 
 void _glfwWaitEventsWayland(void)
@@ -2656,7 +2872,13 @@ void _glfwWaitEventsWayland(void)
 
 void _glfwWaitEventsTimeoutWayland(double timeout)
 {
-    handleEvents(&timeout);
+    const uint64_t deadline = _glfwGetDeadline(timeout);
+    handleEvents(&deadline);
+}
+
+void _glfwWaitEventsUntilWayland(uint64_t deadline)
+{
+    handleEvents(&deadline);
 }
 
 void _glfwPostEmptyEventWayland(void)
@@ -2869,7 +3091,7 @@ void _glfwDestroyCursorWayland(_GLFWcursor* cursor)
         return;
 
     if (cursor->wl.buffer)
-        wl_buffer_destroy(cursor->wl.buffer);
+        destroyShmBuffer(cursor->wl.buffer);
 }
 
 static void relativePointerHandleRelativeMotion(void* userData,
@@ -2885,6 +3107,10 @@ static void relativePointerHandleRelativeMotion(void* userData,
     double xpos = window->virtualCursorPosX;
     double ypos = window->virtualCursorPosY;
 
+    // The microsecond timestamp has its own base, unlike the millisecond ones
+    const uint64_t time = ((uint64_t) timeHi << 32) | timeLo;
+    _glfwInputEventTime(_glfwConvertEventTimeMicroseconds(time));
+
     if (window->cursorMode != GLFW_CURSOR_DISABLED)
         return;
 
@@ -3094,20 +3320,39 @@ static void dataSourceHandleSend(void* userData,
                                  const char* mimeType,
                                  int fd)
 {
+    const char* data = NULL;
+    size_t length = 0;
+
     // Ignore it if this is an outdated or invalid request
-    if (_glfw.wl.selectionSource != source ||
-        strcmp(mimeType, "text/plain;charset=utf-8") != 0)
+    if (_glfw.wl.selectionSource == source)
+    {
+        if (_glfw.clipboard.count)
+        {
+            const GLFWclipboarditem* item = _glfwFindClipboardItem(mimeType);
+            if (item)
+            {
+                data = item->data;
+                length = item->size;
+            }
+        }
+        else if (_glfw.wl.clipboardString &&
+                 strcmp(mimeType, "text/plain;charset=utf-8") == 0)
+        {
+            data = _glfw.wl.clipboardString;
+            length = strlen(data);
+        }
+    }
+
+    if (!data)
     {
         close(fd);
         return;
     }
 
-    char* string = _glfw.wl.clipboardString;
-    size_t length = strlen(string);
-
+    // The data is written straight from the clipboard item or string
     while (length > 0)
     {
-        const ssize_t result = write(fd, string, length);
+        const ssize_t result = write(fd, data, length);
         if (result == -1)
         {
             if (errno == EINTR)
@@ -3120,7 +3365,7 @@ static void dataSourceHandleSend(void* userData,
         }
 
         length -= result;
-        string += result;
+        data += result;
     }
 
     close(fd);
@@ -3144,8 +3389,34 @@ static const struct wl_data_source_listener dataSourceListener =
     dataSourceHandleCancelled,
 };
 
+// Sets the selection to a new data source offering the specified MIME types
+//
+static void setSelectionSource(const char** types, int count)
+{
+    _glfw.wl.selectionSource =
+        wl_data_device_manager_create_data_source(_glfw.wl.dataDeviceManager);
+    if (!_glfw.wl.selectionSource)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create clipboard data source");
+        return;
+    }
+    wl_data_source_add_listener(_glfw.wl.selectionSource,
+                                &dataSourceListener,
+                                NULL);
+
+    for (int i = 0; i < count; i++)
+        wl_data_source_offer(_glfw.wl.selectionSource, types[i]);
+
+    wl_data_device_set_selection(_glfw.wl.dataDevice,
+                                 _glfw.wl.selectionSource,
+                                 _glfw.wl.serial);
+}
+
 void _glfwSetClipboardStringWayland(const char* string)
 {
+    static const char* textTypes[] = { "text/plain;charset=utf-8" };
+
     if (_glfw.wl.selectionSource)
     {
         wl_data_source_destroy(_glfw.wl.selectionSource);
@@ -3162,26 +3433,26 @@ void _glfwSetClipboardStringWayland(const char* string)
     _glfw_free(_glfw.wl.clipboardString);
     _glfw.wl.clipboardString = copy;
 
-    _glfw.wl.selectionSource =
-        wl_data_device_manager_create_data_source(_glfw.wl.dataDeviceManager);
-    if (!_glfw.wl.selectionSource)
+    setSelectionSource(textTypes, 1);
+}
+
+// Returns whether the current selection offer includes the specified MIME type
+//
+static GLFWbool selectionOfferHasType(const char* type)
+{
+    for (unsigned int i = 0; i < _glfw.wl.selectionTypeCount; i++)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "Wayland: Failed to create clipboard data source");
-        return;
+        if (strcmp(_glfw.wl.selectionTypes[i], type) == 0)
+            return GLFW_TRUE;
     }
-    wl_data_source_add_listener(_glfw.wl.selectionSource,
-                                &dataSourceListener,
-                                NULL);
-    wl_data_source_offer(_glfw.wl.selectionSource, "text/plain;charset=utf-8");
-    wl_data_device_set_selection(_glfw.wl.dataDevice,
-                                 _glfw.wl.selectionSource,
-                                 _glfw.wl.serial);
+
+    return GLFW_FALSE;
 }
 
 const char* _glfwGetClipboardStringWayland(void)
 {
-    if (!_glfw.wl.selectionOffer)
+    if (!_glfw.wl.selectionOffer ||
+        !selectionOfferHasType("text/plain;charset=utf-8"))
     {
         _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
                         "Wayland: No clipboard data available");
@@ -3197,6 +3468,133 @@ const char* _glfwGetClipboardStringWayland(void)
     return _glfw.wl.clipboardString;
 }
 
+void _glfwRequestClipboardStringWayland(void)
+{
+    _glfwInputClipboardString(_glfwGetClipboardStringWayland());
+}
+
+GLFWbool _glfwSetClipboardDataWayland(void)
+{
+    // The string functions are served from the UTF-8 text item, if any
+    char* string = NULL;
+    if (_glfwFindClipboardItem("text/plain;charset=utf-8"))
+    {
+        string = _glfwCopyClipboardItemString();
+        if (!string)
+            return GLFW_FALSE;
+    }
+
+    if (_glfw.wl.selectionSource)
+    {
+        wl_data_source_destroy(_glfw.wl.selectionSource);
+        _glfw.wl.selectionSource = NULL;
+    }
+
+    _glfw_free(_glfw.wl.clipboardString);
+    _glfw.wl.clipboardString = string;
+
+    setSelectionSource(_glfw.clipboard.types, _glfw.clipboard.count);
+    return GLFW_TRUE;
+}
+
+const char** _glfwGetClipboardTypesWayland(int* count)
+{
+    static const char* textTypes[] = { "text/plain;charset=utf-8" };
+
+    if (_glfw.wl.selectionSource)
+    {
+        if (_glfw.clipboard.count)
+        {
+            *count = _glfw.clipboard.count;
+            return _glfw.clipboard.types;
+        }
+
+        if (_glfw.wl.clipboardString)
+        {
+            *count = 1;
+            return textTypes;
+        }
+
+        return NULL;
+    }
+
+    if (!_glfw.wl.selectionOffer)
+        return NULL;
+
+    *count = (int) _glfw.wl.selectionTypeCount;
+    return (const char**) _glfw.wl.selectionTypes;
+}
+
+GLFWbool _glfwReadClipboardDataWayland(const char* type,
+                                       GLFWclipboarddatafun callback,
+                                       void* user)
+{
+    if (_glfw.wl.selectionSource)
+    {
+        const GLFWclipboarditem* item = _glfwFindClipboardItem(type);
+        if (item)
+        {
+            callback(item->data, item->size, user);
+            return GLFW_TRUE;
+        }
+
+        if (_glfw.wl.clipboardString &&
+            strcmp(type, "text/plain;charset=utf-8") == 0)
+        {
+            callback(_glfw.wl.clipboardString,
+                     strlen(_glfw.wl.clipboardString),
+                     user);
+            return GLFW_TRUE;
+        }
+    }
+    else if (_glfw.wl.selectionOffer && selectionOfferHasType(type))
+    {
+        int fds[2];
+
+        if (pipe2(fds, O_CLOEXEC) == -1)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Wayland: Failed to create pipe for data offer: %s",
+                            strerror(errno));
+            return GLFW_FALSE;
+        }
+
+        wl_data_offer_receive(_glfw.wl.selectionOffer, type, fds[1]);
+        flushDisplay();
+        close(fds[1]);
+
+        // Each chunk is passed on as it is read instead of being collected
+        for (;;)
+        {
+            char chunk[16384];
+
+            const ssize_t result = read(fds[0], chunk, sizeof(chunk));
+            if (result == 0)
+                break;
+            else if (result == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "Wayland: Failed to read from data offer pipe: %s",
+                                strerror(errno));
+                close(fds[0]);
+                return GLFW_FALSE;
+            }
+
+            callback(chunk, (size_t) result, user);
+        }
+
+        close(fds[0]);
+        return GLFW_TRUE;
+    }
+
+    _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                    "Wayland: Clipboard data not available as %s", type);
+    return GLFW_FALSE;
+}
+
 EGLenum _glfwGetEGLPlatformWayland(EGLint** attribs)
 {
     if (_glfw.egl.EXT_platform_base && _glfw.egl.EXT_platform_wayland)
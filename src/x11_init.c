@@ -39,6 +39,10 @@
 #include <errno.h>
 #include <assert.h>
 
+#if defined(__linux__)
+ #include <sys/timerfd.h>
+#endif
+
 
 // Translate the X11 KeySyms for a key to a GLFW key code
 // NOTE: This is only used as a fallback, in case the XKB method fails
@@ -750,6 +754,8 @@ static GLFWbool initExtensions(void)
     if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
     {
         XRRSelectInput(_glfw.x11.display, _glfw.x11.root,
+                       RRScreenChangeNotifyMask |
+                       RRCrtcChangeNotifyMask |
                        RROutputChangeNotifyMask);
     }
 
@@ -919,6 +925,8 @@ static GLFWbool initExtensions(void)
     // Custom selection property atom
     _glfw.x11.GLFW_SELECTION =
         XInternAtom(_glfw.x11.display, "GLFW_SELECTION", False);
+    _glfw.x11.GLFW_CLIPBOARD_REQUEST =
+        XInternAtom(_glfw.x11.display, "GLFW_CLIPBOARD_REQUEST", False);
 
     // ICCCM standard clipboard atoms
     _glfw.x11.TARGETS = XInternAtom(_glfw.x11.display, "TARGETS", False);
@@ -1139,18 +1147,8 @@ Cursor _glfwCreateNativeCursorX11(const GLFWimage* image, int xhot, int yhot)
     native->xhot = xhot;
     native->yhot = yhot;
 
-    unsigned char* source = (unsigned char*) image->pixels;
-    XcursorPixel* target = native->pixels;
-
-    for (int i = 0;  i < image->width * image->height;  i++, target++, source += 4)
-    {
-        unsigned int alpha = source[3];
-
-        *target = (alpha << 24) |
-                  ((unsigned char) ((source[0] * alpha) / 255) << 16) |
-                  ((unsigned char) ((source[1] * alpha) / 255) <<  8) |
-                  ((unsigned char) ((source[2] * alpha) / 255) <<  0);
-    }
+    _glfwPremultiplyPixels(native->pixels, image->pixels,
+                           image->width * image->height);
 
     cursor = XcursorImageLoadCursor(_glfw.x11.display, native);
     XcursorImageDestroy(native);
@@ -1183,6 +1181,10 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeX11,
         .setClipboardString = _glfwSetClipboardStringX11,
         .getClipboardString = _glfwGetClipboardStringX11,
+        .requestClipboardString = _glfwRequestClipboardStringX11,
+        .setClipboardData = _glfwSetClipboardDataX11,
+        .getClipboardTypes = _glfwGetClipboardTypesX11,
+        .readClipboardData = _glfwReadClipboardDataX11,
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
         .initJoysticks = _glfwInitJoysticksLinux,
         .terminateJoysticks = _glfwTerminateJoysticksLinux,
@@ -1240,6 +1242,7 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         .pollEvents = _glfwPollEventsX11,
         .waitEvents = _glfwWaitEventsX11,
         .waitEventsTimeout = _glfwWaitEventsTimeoutX11,
+        .waitEventsUntil = _glfwWaitEventsUntilX11,
         .postEmptyEvent = _glfwPostEmptyEventX11,
         .getEGLPlatform = _glfwGetEGLPlatformX11,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayX11,
@@ -1320,6 +1323,9 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
 
 int _glfwInitX11(void)
 {
+    // This must be set before any failure checks
+    _glfw.x11.waitTimerfd = -1;
+
     _glfw.x11.xlib.AllocClassHint = (PFN_XAllocClassHint)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XAllocClassHint");
     _glfw.x11.xlib.AllocSizeHints = (PFN_XAllocSizeHints)
@@ -1380,6 +1386,8 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XFreeCursor");
     _glfw.x11.xlib.FreeEventData = (PFN_XFreeEventData)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XFreeEventData");
+    _glfw.x11.xlib.GetAtomNames = (PFN_XGetAtomNames)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XGetAtomNames");
     _glfw.x11.xlib.GetErrorText = (PFN_XGetErrorText)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XGetErrorText");
     _glfw.x11.xlib.GetEventData = (PFN_XGetEventData)
@@ -1410,10 +1418,14 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XIconifyWindow");
     _glfw.x11.xlib.InternAtom = (PFN_XInternAtom)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XInternAtom");
+    _glfw.x11.xlib.InternAtoms = (PFN_XInternAtoms)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XInternAtoms");
     _glfw.x11.xlib.LookupString = (PFN_XLookupString)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XLookupString");
     _glfw.x11.xlib.MapRaised = (PFN_XMapRaised)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XMapRaised");
+    _glfw.x11.xlib.MaxRequestSize = (PFN_XMaxRequestSize)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XMaxRequestSize");
     _glfw.x11.xlib.MapWindow = (PFN_XMapWindow)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XMapWindow");
     _glfw.x11.xlib.MoveResizeWindow = (PFN_XMoveResizeWindow)
@@ -1531,9 +1543,17 @@ int _glfwInitX11(void)
     if (!createEmptyEventPipe())
         return GLFW_FALSE;
 
+#if defined(__linux__)
+    _glfw.x11.waitTimerfd = timerfd_create(_glfw.timer.posix.clock,
+                                           TFD_CLOEXEC | TFD_NONBLOCK);
+#endif
+
     if (!initExtensions())
         return GLFW_FALSE;
 
+    // Leave room for the request header when sending selection data
+    _glfw.x11.selectionChunkSize = XMaxRequestSize(_glfw.x11.display) * 4 - 100;
+
     _glfw.x11.helperWindowHandle = createHelperWindow();
     _glfw.x11.hiddenCursorHandle = createHiddenCursor();
 
@@ -1574,6 +1594,14 @@ void _glfwTerminateX11(void)
 
     _glfw_free(_glfw.x11.primarySelectionString);
     _glfw_free(_glfw.x11.clipboardString);
+    _glfw_free(_glfw.x11.clipboardRequest.buffer.data);
+    _glfw_free(_glfw.x11.clipboardAtoms);
+    _glfwFreeClipboardTypesX11();
+
+    for (int i = 0;  i < _glfw.x11.transferCount;  i++)
+        _glfw_free(_glfw.x11.transfers[i].copy);
+
+    _glfw_free(_glfw.x11.transfers);
 
     XUnregisterIMInstantiateCallback(_glfw.x11.display,
                                      NULL, NULL, NULL,
@@ -1651,6 +1679,9 @@ void _glfwTerminateX11(void)
         close(_glfw.x11.emptyEventPipe[0]);
         close(_glfw.x11.emptyEventPipe[1]);
     }
+
+    if (_glfw.x11.waitTimerfd >= 0)
+        close(_glfw.x11.waitTimerfd);
 }
 
 #endif // _GLFW_X11
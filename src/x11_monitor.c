@@ -92,6 +92,86 @@ static GLFWvidmode vidmodeFromModeInfo(const XRRModeInfo* mi,
     return mode;
 }
 
+// Lexically compares video modes, used by qsort
+//
+static int compareVideoModes(const void* fp, const void* sp)
+{
+    return _glfwCompareVideoModes(fp, sp);
+}
+
+// Updates the snapshot of the specified monitor from RandR state
+//
+static void updateMonitorState(_GLFWmonitor* monitor,
+                               const XRRScreenResources* sr,
+                               const XRROutputInfo* oi,
+                               const XRRCrtcInfo* ci)
+{
+    GLFWvidmode* modes = _glfw_calloc(oi->nmode, sizeof(GLFWvidmode));
+    int modeCount = 0;
+
+    // Keep the previous snapshot rather than a partial one
+    if (oi->nmode && !modes)
+        return;
+
+    monitor->x11.xpos = ci->x;
+    monitor->x11.ypos = ci->y;
+
+    const XRRModeInfo* mi = getModeInfo(sr, ci->mode);
+    if (mi)
+        monitor->x11.mode = vidmodeFromModeInfo(mi, ci);
+
+    monitor->x11.modeValid = (mi != NULL);
+
+    for (int i = 0;  i < oi->nmode;  i++)
+    {
+        mi = getModeInfo(sr, oi->modes[i]);
+        if (mi && modeIsGood(mi))
+            modes[modeCount++] = vidmodeFromModeInfo(mi, ci);
+    }
+
+    if (modeCount)
+    {
+        int count = 1;
+
+        // Sort the modes so that duplicates are adjacent and can be skipped
+        qsort(modes, modeCount, sizeof(GLFWvidmode), compareVideoModes);
+
+        for (int i = 1;  i < modeCount;  i++)
+        {
+            if (_glfwCompareVideoModes(modes + count - 1, modes + i) != 0)
+                modes[count++] = modes[i];
+        }
+
+        modeCount = count;
+    }
+
+    // Have the shared code retrieve the modes again if they have changed
+    if (modeCount != monitor->x11.modeCount ||
+        (modeCount &&
+         memcmp(modes, monitor->x11.modes, modeCount * sizeof(GLFWvidmode)) != 0))
+        _glfwInvalidateVideoModes(monitor);
+
+    _glfw_free(monitor->x11.modes);
+    monitor->x11.modes = modes;
+    monitor->x11.modeCount = modeCount;
+}
+
+// Updates the snapshot of the specified monitor from the server
+//
+static void refreshMonitorState(_GLFWmonitor* monitor, XRRScreenResources* sr)
+{
+    XRROutputInfo* oi = XRRGetOutputInfo(_glfw.x11.display, sr, monitor->x11.output);
+    XRRCrtcInfo* ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
+
+    if (oi && ci)
+        updateMonitorState(monitor, sr, oi, ci);
+
+    if (ci)
+        XRRFreeCrtcInfo(ci);
+    if (oi)
+        XRRFreeOutputInfo(oi);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -139,13 +219,19 @@ void _glfwPollMonitorsX11(void)
                 if (disconnected[j] &&
                     disconnected[j]->x11.output == sr->outputs[i])
                 {
-                    disconnected[j] = NULL;
                     break;
                 }
             }
 
             if (j < disconnectedCount)
             {
+                // The monitor is still connected but its CRTC may have changed
+                _GLFWmonitor* monitor = disconnected[j];
+                disconnected[j] = NULL;
+
+                monitor->x11.crtc = oi->crtc;
+                refreshMonitorState(monitor, sr);
+
                 XRRFreeOutputInfo(oi);
                 continue;
             }
@@ -175,6 +261,7 @@ void _glfwPollMonitorsX11(void)
             _GLFWmonitor* monitor = _glfwAllocMonitor(oi->name, widthMM, heightMM);
             monitor->x11.output = sr->outputs[i];
             monitor->x11.crtc   = oi->crtc;
+            updateMonitorState(monitor, sr, oi, ci);
 
             for (j = 0;  j < screenCount;  j++)
             {
@@ -269,6 +356,9 @@ void _glfwSetVideoModeX11(_GLFWmonitor* monitor, const GLFWvidmode* desired)
                              ci->rotation,
                              ci->outputs,
                              ci->noutput);
+
+            // The new mode is needed immediately to fit a full screen window
+            refreshMonitorState(monitor, sr);
         }
 
         XRRFreeOutputInfo(oi);
@@ -299,6 +389,8 @@ void _glfwRestoreVideoModeX11(_GLFWmonitor* monitor)
                          ci->outputs,
                          ci->noutput);
 
+        refreshMonitorState(monitor, sr);
+
         XRRFreeCrtcInfo(ci);
         XRRFreeScreenResources(sr);
 
@@ -313,27 +405,17 @@ void _glfwRestoreVideoModeX11(_GLFWmonitor* monitor)
 
 void _glfwFreeMonitorX11(_GLFWmonitor* monitor)
 {
+    _glfw_free(monitor->x11.modes);
 }
 
 void _glfwGetMonitorPosX11(_GLFWmonitor* monitor, int* xpos, int* ypos)
 {
     if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
     {
-        XRRScreenResources* sr =
-            XRRGetScreenResourcesCurrent(_glfw.x11.display, _glfw.x11.root);
-        XRRCrtcInfo* ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
-
-        if (ci)
-        {
-            if (xpos)
-                *xpos = ci->x;
-            if (ypos)
-                *ypos = ci->y;
-
-            XRRFreeCrtcInfo(ci);
-        }
-
-        XRRFreeScreenResources(sr);
+        if (xpos)
+            *xpos = monitor->x11.xpos;
+        if (ypos)
+            *ypos = monitor->x11.ypos;
     }
 }
 
@@ -354,28 +436,14 @@ void _glfwGetMonitorWorkareaX11(_GLFWmonitor* monitor,
 
     if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
     {
-        XRRScreenResources* sr =
-            XRRGetScreenResourcesCurrent(_glfw.x11.display, _glfw.x11.root);
-        XRRCrtcInfo* ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
-
-        areaX = ci->x;
-        areaY = ci->y;
-
-        const XRRModeInfo* mi = getModeInfo(sr, ci->mode);
+        areaX = monitor->x11.xpos;
+        areaY = monitor->x11.ypos;
 
-        if (ci->rotation == RR_Rotate_90 || ci->rotation == RR_Rotate_270)
+        if (monitor->x11.modeValid)
         {
-            areaWidth  = mi->height;
-            areaHeight = mi->width;
+            areaWidth  = monitor->x11.mode.width;
+            areaHeight = monitor->x11.mode.height;
         }
-        else
-        {
-            areaWidth  = mi->width;
-            areaHeight = mi->height;
-        }
-
-        XRRFreeCrtcInfo(ci);
-        XRRFreeScreenResources(sr);
     }
     else
     {
@@ -448,39 +516,14 @@ GLFWvidmode* _glfwGetVideoModesX11(_GLFWmonitor* monitor, int* count)
 
     if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
     {
-        XRRScreenResources* sr =
-            XRRGetScreenResourcesCurrent(_glfw.x11.display, _glfw.x11.root);
-        XRRCrtcInfo* ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
-        XRROutputInfo* oi = XRRGetOutputInfo(_glfw.x11.display, sr, monitor->x11.output);
-
-        result = _glfw_calloc(oi->nmode, sizeof(GLFWvidmode));
-
-        for (int i = 0;  i < oi->nmode;  i++)
+        result = _glfw_calloc(monitor->x11.modeCount, sizeof(GLFWvidmode));
+        if (monitor->x11.modeCount)
         {
-            const XRRModeInfo* mi = getModeInfo(sr, oi->modes[i]);
-            if (!modeIsGood(mi))
-                continue;
-
-            const GLFWvidmode mode = vidmodeFromModeInfo(mi, ci);
-            int j;
-
-            for (j = 0;  j < *count;  j++)
-            {
-                if (_glfwCompareVideoModes(result + j, &mode) == 0)
-                    break;
-            }
-
-            // Skip duplicate modes
-            if (j < *count)
-                continue;
-
-            (*count)++;
-            result[*count - 1] = mode;
+            memcpy(result, monitor->x11.modes,
+                   monitor->x11.modeCount * sizeof(GLFWvidmode));
         }
 
-        XRRFreeOutputInfo(oi);
-        XRRFreeCrtcInfo(ci);
-        XRRFreeScreenResources(sr);
+        *count = monitor->x11.modeCount;
     }
     else
     {
@@ -496,27 +539,13 @@ GLFWbool _glfwGetVideoModeX11(_GLFWmonitor* monitor, GLFWvidmode* mode)
 {
     if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
     {
-        XRRScreenResources* sr =
-            XRRGetScreenResourcesCurrent(_glfw.x11.display, _glfw.x11.root);
-        const XRRModeInfo* mi = NULL;
-
-        XRRCrtcInfo* ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
-        if (ci)
-        {
-            mi = getModeInfo(sr, ci->mode);
-            if (mi)
-                *mode = vidmodeFromModeInfo(mi, ci);
-
-            XRRFreeCrtcInfo(ci);
-        }
-
-        XRRFreeScreenResources(sr);
-
-        if (!mi)
+        if (!monitor->x11.modeValid)
         {
             _glfwInputError(GLFW_PLATFORM_ERROR, "X11: Failed to query video mode");
             return GLFW_FALSE;
         }
+
+        *mode = monitor->x11.mode;
     }
     else
     {
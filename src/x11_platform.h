@@ -127,6 +127,7 @@ typedef int (* PFN_XFree)(void*);
 typedef int (* PFN_XFreeColormap)(Display*,Colormap);
 typedef int (* PFN_XFreeCursor)(Display*,Cursor);
 typedef void (* PFN_XFreeEventData)(Display*,XGenericEventCookie*);
+typedef Status (* PFN_XGetAtomNames)(Display*,Atom*,int,char**);
 typedef int (* PFN_XGetErrorText)(Display*,int,char*,int);
 typedef Bool (* PFN_XGetEventData)(Display*,XGenericEventCookie*);
 typedef char* (* PFN_XGetICValues)(XIC,...);
@@ -143,8 +144,10 @@ typedef int (* PFN_XGrabPointer)(Display*,Window,Bool,unsigned int,int,int,Windo
 typedef Status (* PFN_XIconifyWindow)(Display*,Window,int);
 typedef Status (* PFN_XInitThreads)(void);
 typedef Atom (* PFN_XInternAtom)(Display*,const char*,Bool);
+typedef Status (* PFN_XInternAtoms)(Display*,char**,int,Bool,Atom*);
 typedef int (* PFN_XLookupString)(XKeyEvent*,char*,int,KeySym*,XComposeStatus*);
 typedef int (* PFN_XMapRaised)(Display*,Window);
+typedef long (* PFN_XMaxRequestSize)(Display*);
 typedef int (* PFN_XMapWindow)(Display*,Window);
 typedef int (* PFN_XMoveResizeWindow)(Display*,Window,int,int,unsigned int,unsigned int);
 typedef int (* PFN_XMoveWindow)(Display*,Window,int,int);
@@ -229,6 +232,7 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XFreeColormap _glfw.x11.xlib.FreeColormap
 #define XFreeCursor _glfw.x11.xlib.FreeCursor
 #define XFreeEventData _glfw.x11.xlib.FreeEventData
+#define XGetAtomNames _glfw.x11.xlib.GetAtomNames
 #define XGetErrorText _glfw.x11.xlib.GetErrorText
 #define XGetEventData _glfw.x11.xlib.GetEventData
 #define XGetICValues _glfw.x11.xlib.GetICValues
@@ -244,8 +248,10 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XGrabPointer _glfw.x11.xlib.GrabPointer
 #define XIconifyWindow _glfw.x11.xlib.IconifyWindow
 #define XInternAtom _glfw.x11.xlib.InternAtom
+#define XInternAtoms _glfw.x11.xlib.InternAtoms
 #define XLookupString _glfw.x11.xlib.LookupString
 #define XMapRaised _glfw.x11.xlib.MapRaised
+#define XMaxRequestSize _glfw.x11.xlib.MaxRequestSize
 #define XMapWindow _glfw.x11.xlib.MapWindow
 #define XMoveResizeWindow _glfw.x11.xlib.MoveResizeWindow
 #define XMoveWindow _glfw.x11.xlib.MoveWindow
@@ -397,6 +403,8 @@ typedef Bool (*PFNGLXQUERYEXTENSIONPROC)(Display*,int*,int*);
 typedef Bool (*PFNGLXQUERYVERSIONPROC)(Display*,int*,int*);
 typedef void (*PFNGLXDESTROYCONTEXTPROC)(Display*,GLXContext);
 typedef Bool (*PFNGLXMAKECURRENTPROC)(Display*,GLXDrawable,GLXContext);
+typedef GLXContext (*PFNGLXGETCURRENTCONTEXTPROC)(void);
+typedef GLXDrawable (*PFNGLXGETCURRENTDRAWABLEPROC)(void);
 typedef void (*PFNGLXSWAPBUFFERSPROC)(Display*,GLXDrawable);
 typedef const char* (*PFNGLXQUERYEXTENSIONSSTRINGPROC)(Display*,int);
 typedef GLXFBConfig* (*PFNGLXGETFBCONFIGSPROC)(Display*,int,int*);
@@ -419,6 +427,8 @@ typedef GLXContext (*PFNGLXCREATECONTEXTATTRIBSARBPROC)(Display*,GLXFBConfig,GLX
 #define glXQueryVersion _glfw.glx.QueryVersion
 #define glXDestroyContext _glfw.glx.DestroyContext
 #define glXMakeCurrent _glfw.glx.MakeCurrent
+#define glXGetCurrentContext _glfw.glx.GetCurrentContext
+#define glXGetCurrentDrawable _glfw.glx.GetCurrentDrawable
 #define glXSwapBuffers _glfw.glx.SwapBuffers
 #define glXQueryExtensionsString _glfw.glx.QueryExtensionsString
 #define glXCreateNewContext _glfw.glx.CreateNewContext
@@ -482,6 +492,8 @@ typedef struct _GLFWlibraryGLX
 
     void*           handle;
 
+    _GLFWfbconfigcache* fbconfigs;
+
     // GLX 1.3 functions
     PFNGLXGETFBCONFIGSPROC              GetFBConfigs;
     PFNGLXGETFBCONFIGATTRIBPROC         GetFBConfigAttrib;
@@ -490,6 +502,8 @@ typedef struct _GLFWlibraryGLX
     PFNGLXQUERYVERSIONPROC              QueryVersion;
     PFNGLXDESTROYCONTEXTPROC            DestroyContext;
     PFNGLXMAKECURRENTPROC               MakeCurrent;
+    PFNGLXGETCURRENTCONTEXTPROC         GetCurrentContext;
+    PFNGLXGETCURRENTDRAWABLEPROC        GetCurrentDrawable;
     PFNGLXSWAPBUFFERSPROC               SwapBuffers;
     PFNGLXQUERYEXTENSIONSSTRINGPROC     QueryExtensionsString;
     PFNGLXCREATENEWCONTEXTPROC          CreateNewContext;
@@ -534,9 +548,20 @@ typedef struct _GLFWwindowX11
     // Whether the visual supports framebuffer transparency
     GLFWbool        transparent;
 
-    // Cached position and size used to filter out duplicate events
+    // Position and size as of the last ConfigureNotify, used to filter out
+    // duplicate events and to answer the window geometry getters
     int             width, height;
     int             xpos, ypos;
+    // Size last requested for the window, used for the fixed size hints of
+    // non-resizable windows before the server has reported that size
+    int             requestedWidth, requestedHeight;
+    // Position last requested for the window, answered by the position getter
+    // until the next ConfigureNotify reports where the window ended up
+    GLFWbool        positionRequested;
+    int             requestedX, requestedY;
+    // Frame extents as of the last _NET_FRAME_EXTENTS change, if valid
+    GLFWbool        frameExtentsValid;
+    int             frameLeft, frameTop, frameRight, frameBottom;
 
     // The last received cursor position, regardless of source
     int             lastCursorPosX, lastCursorPosY;
@@ -548,6 +573,34 @@ typedef struct _GLFWwindowX11
     Time            keyPressTimes[256];
 } _GLFWwindowX11;
 
+// X11-specific data for an outgoing incremental selection transfer
+//
+typedef struct _GLFWselectionTransferX11
+{
+    Window          requestor;
+    Atom            property;
+    Atom            target;
+    // The selection data, which is only copied into a buffer owned by the
+    // transfer if the selection changes before the transfer is done
+    const char*     data;
+    char*           copy;
+    size_t          size;
+    size_t          offset;
+    // The events this client selected on the requestor before any transfer
+    long            eventMask;
+} _GLFWselectionTransferX11;
+
+// X11-specific buffer for assembling selection data received in chunks
+//
+typedef struct _GLFWselectionBufferX11
+{
+    char*           data;
+    size_t          length;
+    size_t          capacity;
+    // Whether a chunk could not be appended
+    GLFWbool        failed;
+} _GLFWselectionBufferX11;
+
 // X11-specific global data
 //
 typedef struct _GLFWlibraryX11
@@ -574,6 +627,25 @@ typedef struct _GLFWlibraryX11
     char*           primarySelectionString;
     // Clipboard string (while the selection is owned)
     char*           clipboardString;
+    // State of the pending glfwRequestClipboardString transfer, if any
+    struct {
+        GLFWbool    pending;
+        Atom        target;
+        GLFWbool    incremental;
+        _GLFWselectionBufferX11 buffer;
+        // The transfer is abandoned if the owner has not responded by then
+        uint64_t    deadline;
+    } clipboardRequest;
+    // Selection target atoms of the items set with glfwSetClipboardData
+    Atom*           clipboardAtoms;
+    // Target names of the clipboard as returned by glfwGetClipboardTypes
+    char**          clipboardTypes;
+    int             clipboardTypeCount;
+    // Largest selection sent in a single property, larger ones use INCR
+    size_t          selectionChunkSize;
+    // Outgoing incremental selection transfers in progress
+    _GLFWselectionTransferX11* transfers;
+    int             transferCount;
     // Key name string
     char            keynames[GLFW_KEY_LAST + 1][5];
     // X11 keycode to GLFW key LUT
@@ -585,6 +657,10 @@ typedef struct _GLFWlibraryX11
     // The window whose disabled cursor mode is active
     _GLFWwindow*    disabledCursorWindow;
     int             emptyEventPipe[2];
+    // Timer for waiting until an event processing deadline
+    int             waitTimerfd;
+    // Sequence number of the next request at the time of the last flush
+    unsigned long   flushedRequest;
 
     // Window manager atoms
     Atom            NET_SUPPORTED;
@@ -641,6 +717,7 @@ typedef struct _GLFWlibraryX11
     Atom            COMPOUND_STRING;
     Atom            ATOM_PAIR;
     Atom            GLFW_SELECTION;
+    Atom            GLFW_CLIPBOARD_REQUEST;
 
     struct {
         void*       handle;
@@ -675,6 +752,7 @@ typedef struct _GLFWlibraryX11
         PFN_XFreeColormap FreeColormap;
         PFN_XFreeCursor FreeCursor;
         PFN_XFreeEventData FreeEventData;
+        PFN_XGetAtomNames GetAtomNames;
         PFN_XGetErrorText GetErrorText;
         PFN_XGetEventData GetEventData;
         PFN_XGetICValues GetICValues;
@@ -690,8 +768,10 @@ typedef struct _GLFWlibraryX11
         PFN_XGrabPointer GrabPointer;
         PFN_XIconifyWindow IconifyWindow;
         PFN_XInternAtom InternAtom;
+        PFN_XInternAtoms InternAtoms;
         PFN_XLookupString LookupString;
         PFN_XMapRaised MapRaised;
+        PFN_XMaxRequestSize MaxRequestSize;
         PFN_XMapWindow MapWindow;
         PFN_XMoveResizeWindow MoveResizeWindow;
         PFN_XMoveWindow MoveWindow;
@@ -887,6 +967,14 @@ typedef struct _GLFWmonitorX11
     // Index of corresponding Xinerama screen,
     // for EWMH full screen window placement
     int             index;
+
+    // Snapshot of the CRTC and output state, refreshed when RandR reports
+    // a change so that the monitor getters need no server round trips
+    int             xpos, ypos;
+    GLFWbool        modeValid;
+    GLFWvidmode     mode;
+    GLFWvidmode*    modes;
+    int             modeCount;
 } _GLFWmonitorX11;
 
 // X11-specific per-cursor data
@@ -941,6 +1029,7 @@ GLFWbool _glfwRawMouseMotionSupportedX11(void);
 void _glfwPollEventsX11(void);
 void _glfwWaitEventsX11(void);
 void _glfwWaitEventsTimeoutX11(double timeout);
+void _glfwWaitEventsUntilX11(uint64_t deadline);
 void _glfwPostEmptyEventX11(void);
 
 void _glfwGetCursorPosX11(_GLFWwindow* window, double* xpos, double* ypos);
@@ -954,6 +1043,10 @@ void _glfwDestroyCursorX11(_GLFWcursor* cursor);
 void _glfwSetCursorX11(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringX11(const char* string);
 const char* _glfwGetClipboardStringX11(void);
+void _glfwRequestClipboardStringX11(void);
+GLFWbool _glfwSetClipboardDataX11(void);
+const char** _glfwGetClipboardTypesX11(int* count);
+GLFWbool _glfwReadClipboardDataX11(const char* type, GLFWclipboarddatafun callback, void* user);
 
 EGLenum _glfwGetEGLPlatformX11(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayX11(void);
@@ -989,6 +1082,7 @@ void _glfwReleaseErrorHandlerX11(void);
 void _glfwInputErrorX11(int error, const char* message);
 
 void _glfwPushSelectionToManagerX11(void);
+void _glfwFreeClipboardTypesX11(void);
 void _glfwCreateInputContextX11(_GLFWwindow* window);
 
 GLFWbool _glfwInitGLX(void);
@@ -1001,4 +1095,5 @@ GLFWbool _glfwChooseVisualGLX(const _GLFWwndconfig* wndconfig,
                               const _GLFWctxconfig* ctxconfig,
                               const _GLFWfbconfig* fbconfig,
                               Visual** visual, int* depth);
+GLFWbool _glfwPreloadFBConfigsGLX(const _GLFWfbconfig* fbconfig);
 
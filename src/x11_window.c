@@ -60,13 +60,13 @@
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
 //
-static GLFWbool waitForX11Event(double* timeout)
+static GLFWbool waitForX11Event(const uint64_t* deadline)
 {
     struct pollfd fd = { ConnectionNumber(_glfw.x11.display), POLLIN };
 
     while (!XPending(_glfw.x11.display))
     {
-        if (!_glfwPollPOSIX(&fd, 1, timeout))
+        if (!_glfwPollPOSIX(&fd, 1, _glfw.x11.waitTimerfd, deadline))
             return GLFW_FALSE;
     }
 
@@ -77,26 +77,32 @@ static GLFWbool waitForX11Event(double* timeout)
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
 //
-static GLFWbool waitForAnyEvent(double* timeout)
+static GLFWbool waitForAnyEvent(const uint64_t* deadline)
 {
-    enum { XLIB_FD, PIPE_FD, INOTIFY_FD };
+    enum { XLIB_FD, PIPE_FD, JOYSTICK_FD };
     struct pollfd fds[] =
     {
         [XLIB_FD] = { ConnectionNumber(_glfw.x11.display), POLLIN },
         [PIPE_FD] = { _glfw.x11.emptyEventPipe[0], POLLIN },
-        [INOTIFY_FD] = { -1, POLLIN }
+        [JOYSTICK_FD] = { -1, POLLIN }
     };
 
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        fds[INOTIFY_FD].fd = _glfw.linjs.inotify;
+        fds[JOYSTICK_FD].fd = _glfw.linjs.epoll;
 #endif
 
     while (!XPending(_glfw.x11.display))
     {
-        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), timeout))
+        GLFWbool ready;
+
+        if (!_glfwPollWaitFdsPOSIX(fds, sizeof(fds) / sizeof(fds[0]),
+                                   _glfw.x11.waitTimerfd, deadline, &ready))
             return GLFW_FALSE;
 
+        if (ready)
+            return GLFW_TRUE;
+
         for (int i = 1; i < sizeof(fds) / sizeof(fds[0]); i++)
         {
             if (fds[i].revents & POLLIN)
@@ -139,14 +145,14 @@ static void drainEmptyEvents(void)
 static GLFWbool waitForVisibilityNotify(_GLFWwindow* window)
 {
     XEvent dummy;
-    double timeout = 0.1;
+    const uint64_t deadline = _glfwGetDeadline(0.1);
 
     while (!XCheckTypedWindowEvent(_glfw.x11.display,
                                    window->x11.handle,
                                    VisibilityNotify,
                                    &dummy))
     {
-        if (!waitForX11Event(&timeout))
+        if (!waitForX11Event(&deadline))
             return GLFW_FALSE;
     }
 
@@ -181,6 +187,18 @@ static int getWindowState(_GLFWwindow* window)
 //
 static Bool isSelectionEvent(Display* display, XEvent* event, XPointer pointer)
 {
+    if (event->type == PropertyNotify || event->type == DestroyNotify)
+    {
+        // Incremental transfers are driven by events for the requestor window
+        for (int i = 0;  i < _glfw.x11.transferCount;  i++)
+        {
+            if (_glfw.x11.transfers[i].requestor == event->xany.window)
+                return True;
+        }
+
+        return False;
+    }
+
     if (event->xany.window != _glfw.x11.helperWindowHandle)
         return False;
 
@@ -189,6 +207,28 @@ static Bool isSelectionEvent(Display* display, XEvent* event, XPointer pointer)
            event->type == SelectionClear;
 }
 
+// Returns whether it is the notification for the specified selection request
+//
+static Bool isSelectionNotify(Display* display, XEvent* event, XPointer pointer)
+{
+    XEvent* request = (XEvent*) pointer;
+
+    if (event->type != SelectionNotify ||
+        event->xselection.requestor != request->xselection.requestor)
+    {
+        return False;
+    }
+
+    // A refused conversion has no property, so match it by what was requested
+    if (event->xselection.property == None)
+    {
+        return event->xselection.selection == request->xselection.selection &&
+               event->xselection.target == request->xselection.target;
+    }
+
+    return event->xselection.property == request->xselection.property;
+}
+
 // Returns whether it is a _NET_FRAME_EXTENTS event for the specified window
 //
 static Bool isFrameExtentsEvent(Display* display, XEvent* event, XPointer pointer)
@@ -622,6 +662,13 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
         return GLFW_FALSE;
     }
 
+    window->x11.xpos = xpos;
+    window->x11.ypos = ypos;
+    window->x11.width = width;
+    window->x11.height = height;
+    window->x11.requestedWidth = width;
+    window->x11.requestedHeight = height;
+
     XSaveContext(_glfw.x11.display,
                  window->x11.handle,
                  _glfw.x11.context,
@@ -781,25 +828,312 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
         _glfwCreateInputContextX11(window);
 
     _glfwSetWindowTitleX11(window, wndconfig->title);
-    _glfwGetWindowPosX11(window, &window->x11.xpos, &window->x11.ypos);
-    _glfwGetWindowSizeX11(window, &window->x11.width, &window->x11.height);
 
     return GLFW_TRUE;
 }
 
-// Set the specified property to the selection converted to the requested target
+// Returns the index of the outgoing selection transfer to the specified
+// property, or -1 if there is none
 //
-static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
+static int findSelectionTransfer(Window requestor, Atom property)
+{
+    for (int i = 0;  i < _glfw.x11.transferCount;  i++)
+    {
+        if (_glfw.x11.transfers[i].requestor == requestor &&
+            _glfw.x11.transfers[i].property == property)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+// Returns the events this client selects on the specified requestor window
+// when no selection transfer is using it
+//
+static long getRequestorEventMask(Window requestor)
+{
+    for (int i = 0;  i < _glfw.x11.transferCount;  i++)
+    {
+        if (_glfw.x11.transfers[i].requestor == requestor)
+            return _glfw.x11.transfers[i].eventMask;
+    }
+
+    // Only our own windows are known to exist and to have events selected
+    XPointer window;
+    if (requestor == _glfw.x11.helperWindowHandle ||
+        XFindContext(_glfw.x11.display,
+                     requestor,
+                     _glfw.x11.context,
+                     &window) == 0)
+    {
+        XWindowAttributes attribs;
+        if (XGetWindowAttributes(_glfw.x11.display, requestor, &attribs))
+            return attribs.your_event_mask;
+    }
+
+    return NoEventMask;
+}
+
+// Removes the specified outgoing selection transfer
+//
+static void removeSelectionTransfer(int index, GLFWbool deselect)
+{
+    const Window requestor = _glfw.x11.transfers[index].requestor;
+    const long eventMask = _glfw.x11.transfers[index].eventMask;
+
+    _glfw_free(_glfw.x11.transfers[index].copy);
+    _glfw.x11.transfers[index] =
+        _glfw.x11.transfers[--_glfw.x11.transferCount];
+
+    if (!deselect)
+        return;
+
+    for (int i = 0;  i < _glfw.x11.transferCount;  i++)
+    {
+        if (_glfw.x11.transfers[i].requestor == requestor)
+            return;
+    }
+
+    XSelectInput(_glfw.x11.display, requestor, eventMask);
+}
+
+// Gives each outgoing selection transfer its own copy of the data it has yet
+// to send, as the selection data it refers to is about to be freed
+//
+static void detachSelectionTransfers(void)
+{
+    for (int i = 0;  i < _glfw.x11.transferCount;  )
+    {
+        _GLFWselectionTransferX11* transfer = _glfw.x11.transfers + i;
+
+        if (transfer->copy)
+        {
+            i++;
+            continue;
+        }
+
+        const size_t size = transfer->size - transfer->offset;
+        transfer->copy = _glfw_calloc(size + 1, 1);
+        if (!transfer->copy)
+        {
+            removeSelectionTransfer(i, GLFW_TRUE);
+            continue;
+        }
+
+        memcpy(transfer->copy, transfer->data + transfer->offset, size);
+        transfer->data = transfer->copy;
+        transfer->size = size;
+        transfer->offset = 0;
+        i++;
+    }
+}
+
+// Writes selection data to the specified requestor property, starting an
+// incremental transfer (ICCCM section 2.7.2) if it does not fit in one request
+//
+static GLFWbool writeSelectionData(Window requestor,
+                                   Atom property,
+                                   Atom target,
+                                   const char* data,
+                                   size_t size)
+{
+    if (size <= _glfw.x11.selectionChunkSize)
+    {
+        XChangeProperty(_glfw.x11.display,
+                        requestor,
+                        property,
+                        target,
+                        8,
+                        PropModeReplace,
+                        (unsigned char*) data,
+                        size);
+
+        _GLFW_COUNT_ATOMIC(GLFW_SELECTION_BYTES, size);
+        return GLFW_TRUE;
+    }
+
+    int index = findSelectionTransfer(requestor, property);
+    if (index != -1)
+    {
+        // The requestor has reused the property, abandoning the old transfer
+        _glfw_free(_glfw.x11.transfers[index].copy);
+    }
+    else
+    {
+        const long eventMask = getRequestorEventMask(requestor);
+
+        _GLFWselectionTransferX11* transfers =
+            _glfw_realloc(_glfw.x11.transfers,
+                          sizeof(_GLFWselectionTransferX11) *
+                          (_glfw.x11.transferCount + 1));
+        if (!transfers)
+            return GLFW_FALSE;
+
+        _glfw.x11.transfers = transfers;
+        index = _glfw.x11.transferCount++;
+        _glfw.x11.transfers[index].eventMask = eventMask;
+    }
+
+    // The data is sent from the selection itself until the selection changes
+    _GLFWselectionTransferX11* transfer = _glfw.x11.transfers + index;
+    transfer->requestor = requestor;
+    transfer->property = property;
+    transfer->target = target;
+    transfer->data = data;
+    transfer->copy = NULL;
+    transfer->size = size;
+    transfer->offset = 0;
+
+    // The requestor deletes the property to ask for each chunk, and the
+    // transfer is dropped if the requestor window is destroyed
+    XSelectInput(_glfw.x11.display,
+                 requestor,
+                 transfer->eventMask | PropertyChangeMask | StructureNotifyMask);
+
+    const long lowerBound = (long) size;
+    XChangeProperty(_glfw.x11.display,
+                    requestor,
+                    property,
+                    _glfw.x11.INCR,
+                    32,
+                    PropModeReplace,
+                    (unsigned char*) &lowerBound,
+                    1);
+
+    _GLFW_COUNT_ATOMIC(GLFW_SELECTION_TRANSFERS, 1);
+    return GLFW_TRUE;
+}
+
+// Advances the outgoing selection transfers on a requestor window event
+// Returns whether the event belonged to a selection transfer
+//
+static GLFWbool handleSelectionTransferEvent(const XEvent* event)
+{
+    if (event->type == DestroyNotify)
+    {
+        GLFWbool found = GLFW_FALSE;
+
+        for (int i = 0;  i < _glfw.x11.transferCount;  )
+        {
+            if (_glfw.x11.transfers[i].requestor == event->xdestroywindow.window)
+            {
+                removeSelectionTransfer(i, GLFW_FALSE);
+                found = GLFW_TRUE;
+            }
+            else
+                i++;
+        }
+
+        return found;
+    }
+
+    if (event->type != PropertyNotify ||
+        event->xproperty.state != PropertyDelete)
+    {
+        return GLFW_FALSE;
+    }
+
+    const int index = findSelectionTransfer(event->xproperty.window,
+                                            event->xproperty.atom);
+    if (index == -1)
+        return GLFW_FALSE;
+
+    const uint64_t start = _glfwPlatformGetTimerValue();
+    _GLFWselectionTransferX11* transfer = _glfw.x11.transfers + index;
+
+    size_t count = transfer->size - transfer->offset;
+    if (count > _glfw.x11.selectionChunkSize)
+        count = _glfw.x11.selectionChunkSize;
+
+    // The final chunk is empty and tells the requestor the transfer is done
+    XChangeProperty(_glfw.x11.display,
+                    transfer->requestor,
+                    transfer->property,
+                    transfer->target,
+                    8,
+                    PropModeReplace,
+                    (unsigned char*) transfer->data + transfer->offset,
+                    count);
+
+    transfer->offset += count;
+
+    _GLFW_COUNT_ATOMIC(GLFW_SELECTION_CHUNKS, 1);
+    _GLFW_COUNT_ATOMIC(GLFW_SELECTION_BYTES, count);
+
+    if (!count)
+        removeSelectionTransfer(index, GLFW_TRUE);
+
+    _GLFW_COUNT_ATOMIC(GLFW_SELECTION_TIME, _glfwPlatformGetTimerValue() - start);
+    return GLFW_TRUE;
+}
+
+// Returns the data of a selection owned by GLFW converted to the specified
+// target, if it is available as that target
+//
+static GLFWbool getOwnedSelectionData(Atom selection,
+                                      Atom target,
+                                      const char** data,
+                                      size_t* size)
 {
-    char* selectionString = NULL;
-    const Atom formats[] = { _glfw.x11.UTF8_STRING, XA_STRING };
-    const int formatCount = sizeof(formats) / sizeof(formats[0]);
+    if (selection == _glfw.x11.CLIPBOARD && _glfw.clipboard.count)
+    {
+        if (!_glfw.x11.clipboardAtoms)
+            return GLFW_FALSE;
+
+        for (int i = 0;  i < _glfw.clipboard.count;  i++)
+        {
+            const GLFWclipboarditem* item = _glfw.clipboard.items + i;
 
-    if (request->selection == _glfw.x11.PRIMARY)
-        selectionString = _glfw.x11.primarySelectionString;
+            if (_glfw.x11.clipboardAtoms[i] == target ||
+                (target == _glfw.x11.UTF8_STRING &&
+                 strcmp(item->type, "text/plain;charset=utf-8") == 0))
+            {
+                *data = item->data;
+                *size = item->size;
+                return GLFW_TRUE;
+            }
+        }
+
+        return GLFW_FALSE;
+    }
+
+    const char* string;
+
+    if (selection == _glfw.x11.PRIMARY)
+        string = _glfw.x11.primarySelectionString;
     else
-        selectionString = _glfw.x11.clipboardString;
+        string = _glfw.x11.clipboardString;
+
+    if (!string || (target != _glfw.x11.UTF8_STRING && target != XA_STRING))
+        return GLFW_FALSE;
+
+    *data = string;
+    *size = strlen(string);
+    return GLFW_TRUE;
+}
+
+// Writes the selection converted to the specified target to the specified
+// requestor property
+//
+static GLFWbool writeTargetData(const XSelectionRequestEvent* request,
+                                Atom property,
+                                Atom target)
+{
+    const char* data;
+    size_t size;
+
+    if (!getOwnedSelectionData(request->selection, target, &data, &size))
+        return GLFW_FALSE;
 
+    return writeSelectionData(request->requestor, property, target, data, size);
+}
+
+// Set the specified property to the selection converted to the requested target
+//
+static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
+{
     if (request->property == None)
     {
         // The requester is a legacy client (ICCCM section 2.2)
@@ -811,10 +1145,31 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
     {
         // The list of supported targets was requested
 
-        const Atom targets[] = { _glfw.x11.TARGETS,
-                                 _glfw.x11.MULTIPLE,
-                                 _glfw.x11.UTF8_STRING,
-                                 XA_STRING };
+        int itemCount = 0;
+        if (request->selection == _glfw.x11.CLIPBOARD && _glfw.x11.clipboardAtoms)
+            itemCount = _glfw.clipboard.count;
+
+        Atom* targets = _glfw_calloc(4 + itemCount, sizeof(Atom));
+        if (!targets)
+            return None;
+
+        int targetCount = 0;
+        targets[targetCount++] = _glfw.x11.TARGETS;
+        targets[targetCount++] = _glfw.x11.MULTIPLE;
+
+        if (itemCount)
+        {
+            if (_glfwFindClipboardItem("text/plain;charset=utf-8"))
+                targets[targetCount++] = _glfw.x11.UTF8_STRING;
+
+            for (int i = 0;  i < itemCount;  i++)
+                targets[targetCount++] = _glfw.x11.clipboardAtoms[i];
+        }
+        else
+        {
+            targets[targetCount++] = _glfw.x11.UTF8_STRING;
+            targets[targetCount++] = XA_STRING;
+        }
 
         XChangeProperty(_glfw.x11.display,
                         request->requestor,
@@ -823,8 +1178,9 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
                         32,
                         PropModeReplace,
                         (unsigned char*) targets,
-                        sizeof(targets) / sizeof(targets[0]));
+                        targetCount);
 
+        _glfw_free(targets);
         return request->property;
     }
 
@@ -841,26 +1197,7 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 
         for (unsigned long i = 0;  i < count;  i += 2)
         {
-            int j;
-
-            for (j = 0;  j < formatCount;  j++)
-            {
-                if (targets[i] == formats[j])
-                    break;
-            }
-
-            if (j < formatCount)
-            {
-                XChangeProperty(_glfw.x11.display,
-                                request->requestor,
-                                targets[i + 1],
-                                targets[i],
-                                8,
-                                PropModeReplace,
-                                (unsigned char *) selectionString,
-                                strlen(selectionString));
-            }
-            else
+            if (!writeTargetData(request, targets[i + 1], targets[i]))
                 targets[i + 1] = None;
         }
 
@@ -897,24 +1234,8 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 
     // Conversion to a data target was requested
 
-    for (int i = 0;  i < formatCount;  i++)
-    {
-        if (request->target == formats[i])
-        {
-            // The requested target is one we support
-
-            XChangeProperty(_glfw.x11.display,
-                            request->requestor,
-                            request->property,
-                            request->target,
-                            8,
-                            PropModeReplace,
-                            (unsigned char *) selectionString,
-                            strlen(selectionString));
-
-            return request->property;
-        }
-    }
+    if (writeTargetData(request, request->property, request->target))
+        return request->property;
 
     // The requested target is not supported
 
@@ -923,6 +1244,7 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 
 static void handleSelectionRequest(XEvent* event)
 {
+    const uint64_t start = _glfwPlatformGetTimerValue();
     const XSelectionRequestEvent* request = &event->xselectionrequest;
 
     XEvent reply = { SelectionNotify };
@@ -934,6 +1256,180 @@ static void handleSelectionRequest(XEvent* event)
     reply.xselection.time = request->time;
 
     XSendEvent(_glfw.x11.display, request->requestor, False, 0, &reply);
+
+    _GLFW_COUNT_ATOMIC(GLFW_SELECTION_REQUESTS, 1);
+    _GLFW_COUNT_ATOMIC(GLFW_SELECTION_TIME, _glfwPlatformGetTimerValue() - start);
+}
+
+// Appends a chunk of selection data to a growing NUL-terminated buffer
+// The buffer grows geometrically so an incremental transfer is linear in size
+//
+static GLFWbool appendSelectionData(_GLFWselectionBufferX11* buffer,
+                                    const char* data,
+                                    size_t count)
+{
+    if (buffer->failed)
+        return GLFW_FALSE;
+
+    if (buffer->length + count + 1 > buffer->capacity)
+    {
+        size_t size = buffer->capacity ? buffer->capacity : 4096;
+        while (size < buffer->length + count + 1)
+            size *= 2;
+
+        char* resized = _glfw_realloc(buffer->data, size);
+        if (!resized)
+        {
+            buffer->failed = GLFW_TRUE;
+            return GLFW_FALSE;
+        }
+
+        buffer->data = resized;
+        buffer->capacity = size;
+    }
+
+    memcpy(buffer->data + buffer->length, data, count);
+    buffer->length += count;
+    buffer->data[buffer->length] = '\0';
+    return GLFW_TRUE;
+}
+
+// Appends a chunk passed on by readSelectionData to a selection buffer
+//
+static void appendSelectionChunk(const void* data, size_t size, void* user)
+{
+    appendSelectionData(user, data, size);
+}
+
+// Asks the owner of the selection to convert it to the specified target and
+// waits for the reply
+// Returns whether the owner stored the converted selection in the property
+//
+static GLFWbool convertSelection(Atom selection,
+                                 Atom target,
+                                 XEvent* notification)
+{
+    XEvent request;
+
+    XConvertSelection(_glfw.x11.display,
+                      selection,
+                      target,
+                      _glfw.x11.GLFW_SELECTION,
+                      _glfw.x11.helperWindowHandle,
+                      CurrentTime);
+
+    // Only wait for the reply to this request, leaving any reply to a
+    // pending glfwRequestClipboardString in the queue
+    request.xselection.requestor = _glfw.x11.helperWindowHandle;
+    request.xselection.selection = selection;
+    request.xselection.target = target;
+    request.xselection.property = _glfw.x11.GLFW_SELECTION;
+
+    while (!XCheckIfEvent(_glfw.x11.display,
+                          notification,
+                          isSelectionNotify,
+                          (XPointer) &request))
+    {
+        waitForX11Event(NULL);
+    }
+
+    return notification->xselection.property != None;
+}
+
+// Returns the size in bytes of property data in the specified format
+//
+static size_t getPropertyDataSize(int format, unsigned long itemCount)
+{
+    // Xlib returns 32-bit property data as an array of long
+    if (format == 32)
+        return itemCount * sizeof(long);
+    else if (format == 16)
+        return itemCount * sizeof(short);
+    else
+        return itemCount;
+}
+
+// Reads the converted selection from the property named in the notification
+// and passes it on in chunks as they arrive, following the INCR protocol if
+// the owner uses it
+//
+static GLFWbool readSelectionData(XEvent* notification,
+                                  Atom target,
+                                  GLFWclipboarddatafun callback,
+                                  void* user)
+{
+    unsigned char* data;
+    Atom actualType;
+    int actualFormat;
+    unsigned long itemCount, bytesAfter;
+    XEvent dummy;
+
+    XCheckIfEvent(_glfw.x11.display,
+                  &dummy,
+                  isSelPropNewValueNotify,
+                  (XPointer) notification);
+
+    XGetWindowProperty(_glfw.x11.display,
+                       notification->xselection.requestor,
+                       notification->xselection.property,
+                       0,
+                       LONG_MAX,
+                       True,
+                       AnyPropertyType,
+                       &actualType,
+                       &actualFormat,
+                       &itemCount,
+                       &bytesAfter,
+                       &data);
+
+    if (actualType != _glfw.x11.INCR)
+    {
+        const GLFWbool result = actualType == target;
+        if (result)
+            callback(data, getPropertyDataSize(actualFormat, itemCount), user);
+
+        if (data)
+            XFree(data);
+
+        return result;
+    }
+
+    XFree(data);
+
+    for (;;)
+    {
+        while (!XCheckIfEvent(_glfw.x11.display,
+                              &dummy,
+                              isSelPropNewValueNotify,
+                              (XPointer) notification))
+        {
+            waitForX11Event(NULL);
+        }
+
+        XGetWindowProperty(_glfw.x11.display,
+                           notification->xselection.requestor,
+                           notification->xselection.property,
+                           0,
+                           LONG_MAX,
+                           True,
+                           AnyPropertyType,
+                           &actualType,
+                           &actualFormat,
+                           &itemCount,
+                           &bytesAfter,
+                           &data);
+
+        const size_t size = getPropertyDataSize(actualFormat, itemCount);
+        if (size)
+            callback(data, size, user);
+
+        if (data)
+            XFree(data);
+
+        // The transfer ends with an empty chunk
+        if (!size)
+            return GLFW_TRUE;
+    }
 }
 
 static const char* getSelectionString(Atom selection)
@@ -955,128 +1451,182 @@ static const char* getSelectionString(Atom selection)
         return *selectionString;
     }
 
+    detachSelectionTransfers();
     _glfw_free(*selectionString);
     *selectionString = NULL;
 
     for (size_t i = 0;  i < targetCount;  i++)
     {
-        char* data;
-        Atom actualType;
-        int actualFormat;
-        unsigned long itemCount, bytesAfter;
-        XEvent notification, dummy;
+        XEvent notification;
+        _GLFWselectionBufferX11 buffer = {0};
 
-        XConvertSelection(_glfw.x11.display,
-                          selection,
-                          targets[i],
-                          _glfw.x11.GLFW_SELECTION,
-                          _glfw.x11.helperWindowHandle,
-                          CurrentTime);
+        if (!convertSelection(selection, targets[i], &notification))
+            continue;
 
-        while (!XCheckTypedWindowEvent(_glfw.x11.display,
-                                       _glfw.x11.helperWindowHandle,
-                                       SelectionNotify,
-                                       &notification))
+        if (readSelectionData(&notification, targets[i],
+                              appendSelectionChunk, &buffer) &&
+            buffer.data && !buffer.failed)
         {
-            waitForX11Event(NULL);
+            if (targets[i] == XA_STRING)
+            {
+                *selectionString = convertLatin1toUTF8(buffer.data);
+                _glfw_free(buffer.data);
+            }
+            else
+                *selectionString = buffer.data;
+
+            break;
         }
 
-        if (notification.xselection.property == None)
-            continue;
+        _glfw_free(buffer.data);
+    }
 
-        XCheckIfEvent(_glfw.x11.display,
-                      &dummy,
-                      isSelPropNewValueNotify,
-                      (XPointer) &notification);
+    if (!*selectionString)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "X11: Failed to convert selection to string");
+    }
 
-        XGetWindowProperty(_glfw.x11.display,
-                           notification.xselection.requestor,
-                           notification.xselection.property,
-                           0,
-                           LONG_MAX,
-                           True,
-                           AnyPropertyType,
-                           &actualType,
-                           &actualFormat,
-                           &itemCount,
-                           &bytesAfter,
-                           (unsigned char**) &data);
+    return *selectionString;
+}
 
-        if (actualType == _glfw.x11.INCR)
-        {
-            size_t size = 1;
-            char* string = NULL;
+// Completes the pending clipboard request with the specified string
+// The string is in the encoding of the current target, or NULL on failure, in
+// which case the caller has reported the error
+//
+static void finishClipboardRequest(const char* string)
+{
+    char* result = NULL;
 
-            for (;;)
-            {
-                while (!XCheckIfEvent(_glfw.x11.display,
-                                      &dummy,
-                                      isSelPropNewValueNotify,
-                                      (XPointer) &notification))
-                {
-                    waitForX11Event(NULL);
-                }
+    if (string)
+    {
+        if (_glfw.x11.clipboardRequest.target == XA_STRING)
+            result = convertLatin1toUTF8(string);
+        else
+            result = _glfw_strdup(string);
+    }
 
-                XFree(data);
-                XGetWindowProperty(_glfw.x11.display,
-                                   notification.xselection.requestor,
-                                   notification.xselection.property,
-                                   0,
-                                   LONG_MAX,
-                                   True,
-                                   AnyPropertyType,
-                                   &actualType,
-                                   &actualFormat,
-                                   &itemCount,
-                                   &bytesAfter,
-                                   (unsigned char**) &data);
-
-                if (itemCount)
-                {
-                    size += itemCount;
-                    string = _glfw_realloc(string, size);
-                    string[size - itemCount - 1] = '\0';
-                    strcat(string, data);
-                }
+    // The request is reset before the callback so that it can make a new one
+    _glfw_free(_glfw.x11.clipboardRequest.buffer.data);
+    memset(&_glfw.x11.clipboardRequest, 0, sizeof(_glfw.x11.clipboardRequest));
 
-                if (!itemCount)
-                {
-                    if (string)
-                    {
-                        if (targets[i] == XA_STRING)
-                        {
-                            *selectionString = convertLatin1toUTF8(string);
-                            _glfw_free(string);
-                        }
-                        else
-                            *selectionString = string;
-                    }
+    _glfwInputClipboardString(result);
+    _glfw_free(result);
+}
 
-                    break;
-                }
+// Asks the clipboard owner to convert the clipboard to the specified target
+//
+static void convertClipboardRequest(Atom target)
+{
+    _glfw.x11.clipboardRequest.target = target;
+    _glfw.x11.clipboardRequest.incremental = GLFW_FALSE;
+    _glfw.x11.clipboardRequest.buffer.length = 0;
+    _glfw.x11.clipboardRequest.deadline = _glfwGetDeadline(2.0);
+
+    XConvertSelection(_glfw.x11.display,
+                      _glfw.x11.CLIPBOARD,
+                      target,
+                      _glfw.x11.GLFW_CLIPBOARD_REQUEST,
+                      _glfw.x11.helperWindowHandle,
+                      CurrentTime);
+}
+
+// Falls back to the next target of the pending clipboard request, if any
+//
+static void retryClipboardRequest(void)
+{
+    if (_glfw.x11.clipboardRequest.target == _glfw.x11.UTF8_STRING)
+        convertClipboardRequest(XA_STRING);
+    else
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "X11: Failed to convert selection to string");
+        finishClipboardRequest(NULL);
+    }
+}
+
+// Advances the pending clipboard request on a helper window event
+// Each step only reads what has already arrived, so this never blocks
+//
+static void handleClipboardRequestEvent(const XEvent* event)
+{
+    char* data = NULL;
+    Atom actualType;
+    int actualFormat;
+    unsigned long itemCount, bytesAfter;
+
+    if (event->type == SelectionNotify)
+    {
+        if (event->xselection.property == None)
+        {
+            if (event->xselection.selection == _glfw.x11.CLIPBOARD &&
+                event->xselection.target == _glfw.x11.clipboardRequest.target)
+            {
+                retryClipboardRequest();
             }
+
+            return;
         }
-        else if (actualType == targets[i])
+
+        if (event->xselection.property != _glfw.x11.GLFW_CLIPBOARD_REQUEST)
+            return;
+    }
+    else if (event->type == PropertyNotify)
+    {
+        if (!_glfw.x11.clipboardRequest.incremental ||
+            event->xproperty.state != PropertyNewValue ||
+            event->xproperty.atom != _glfw.x11.GLFW_CLIPBOARD_REQUEST)
         {
-            if (targets[i] == XA_STRING)
-                *selectionString = convertLatin1toUTF8(data);
-            else
-                *selectionString = _glfw_strdup(data);
+            return;
         }
+    }
+    else
+        return;
 
-        XFree(data);
+    // Deleting the property tells an incremental owner to send the next chunk
+    XGetWindowProperty(_glfw.x11.display,
+                       _glfw.x11.helperWindowHandle,
+                       _glfw.x11.GLFW_CLIPBOARD_REQUEST,
+                       0,
+                       LONG_MAX,
+                       True,
+                       AnyPropertyType,
+                       &actualType,
+                       &actualFormat,
+                       &itemCount,
+                       &bytesAfter,
+                       (unsigned char**) &data);
 
-        if (*selectionString)
-            break;
-    }
+    // The owner gets the same time for each step of the transfer
+    _glfw.x11.clipboardRequest.deadline = _glfwGetDeadline(2.0);
 
-    if (!*selectionString)
+    if (event->type == SelectionNotify)
     {
-        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
-                        "X11: Failed to convert selection to string");
+        if (actualType == _glfw.x11.INCR)
+            _glfw.x11.clipboardRequest.incremental = GLFW_TRUE;
+        else if (actualType == _glfw.x11.clipboardRequest.target && data)
+            finishClipboardRequest(data);
+        else
+            retryClipboardRequest();
+    }
+    else if (itemCount)
+    {
+        if (!appendSelectionData(&_glfw.x11.clipboardRequest.buffer,
+                                 data, itemCount))
+        {
+            finishClipboardRequest(NULL);
+        }
+    }
+    else
+    {
+        if (_glfw.x11.clipboardRequest.buffer.length)
+            finishClipboardRequest(_glfw.x11.clipboardRequest.buffer.data);
+        else
+            retryClipboardRequest();
     }
 
-    return *selectionString;
+    if (data)
+        XFree(data);
 }
 
 // Make the specified window and its video mode active on its monitor
@@ -1141,6 +1691,28 @@ static void releaseMonitor(_GLFWwindow* window)
     }
 }
 
+// Returns the server timestamp of the specified input event, if it has one
+//
+static Time getEventTime(const XEvent* event)
+{
+    switch (event->type)
+    {
+        case KeyPress:
+        case KeyRelease:
+            return event->xkey.time;
+        case ButtonPress:
+        case ButtonRelease:
+            return event->xbutton.time;
+        case MotionNotify:
+            return event->xmotion.time;
+        case EnterNotify:
+        case LeaveNotify:
+            return event->xcrossing.time;
+        default:
+            return CurrentTime;
+    }
+}
+
 // Process the specified X event
 //
 static void processEvent(XEvent *event)
@@ -1156,7 +1728,8 @@ static void processEvent(XEvent *event)
 
     if (_glfw.x11.randr.available)
     {
-        if (event->type == _glfw.x11.randr.eventBase + RRNotify)
+        if (event->type == _glfw.x11.randr.eventBase + RRNotify ||
+            event->type == _glfw.x11.randr.eventBase + RRScreenChangeNotify)
         {
             XRRUpdateConfiguration(event);
             _glfwPollMonitorsX11();
@@ -1193,6 +1766,8 @@ static void processEvent(XEvent *event)
                 XIRawEvent* re = event->xcookie.data;
                 if (re->valuators.mask_len)
                 {
+                    _glfwInputEventTime(_glfwConvertEventTime(re->time));
+
                     const double* values = re->raw_values;
                     double xpos = window->virtualCursorPosX;
                     double ypos = window->virtualCursorPosY;
@@ -1222,6 +1797,17 @@ static void processEvent(XEvent *event)
         return;
     }
 
+    if (_glfw.x11.transferCount && handleSelectionTransferEvent(event))
+        return;
+
+    if (event->xany.window == _glfw.x11.helperWindowHandle)
+    {
+        if (_glfw.x11.clipboardRequest.pending)
+            handleClipboardRequestEvent(event);
+
+        return;
+    }
+
     _GLFWwindow* window = NULL;
     if (XFindContext(_glfw.x11.display,
                      event->xany.window,
@@ -1236,7 +1822,38 @@ static void processEvent(XEvent *event)
     {
         case ReparentNotify:
         {
+            int xpos = event->xreparent.x;
+            int ypos = event->xreparent.y;
+
             window->x11.parent = event->xreparent.parent;
+
+            // NOTE: Reparenting moves the window without a ConfigureNotify, so
+            //       the cached position is updated here
+            if (window->x11.parent != _glfw.x11.root)
+            {
+                _glfwGrabErrorHandlerX11();
+
+                Window dummy;
+                XTranslateCoordinates(_glfw.x11.display,
+                                      window->x11.parent,
+                                      _glfw.x11.root,
+                                      xpos, ypos,
+                                      &xpos, &ypos,
+                                      &dummy);
+
+                _glfwReleaseErrorHandlerX11();
+                if (_glfw.x11.errorCode == BadWindow)
+                    return;
+            }
+
+            if (xpos != window->x11.xpos || ypos != window->x11.ypos)
+            {
+                window->x11.xpos = xpos;
+                window->x11.ypos = ypos;
+
+                _glfwInputWindowPos(window, xpos, ypos);
+            }
+
             return;
         }
 
@@ -1490,6 +2107,8 @@ static void processEvent(XEvent *event)
             {
                 window->x11.width = event->xconfigure.width;
                 window->x11.height = event->xconfigure.height;
+                window->x11.requestedWidth = event->xconfigure.width;
+                window->x11.requestedHeight = event->xconfigure.height;
 
                 _glfwInputFramebufferSize(window,
                                           event->xconfigure.width,
@@ -1523,6 +2142,10 @@ static void processEvent(XEvent *event)
                     return;
             }
 
+            // The window manager answers every move request with a
+            // ConfigureNotify, even if it refused it
+            window->x11.positionRequested = GLFW_FALSE;
+
             if (xpos != window->x11.xpos || ypos != window->x11.ypos)
             {
                 window->x11.xpos = xpos;
@@ -1791,6 +2414,14 @@ static void processEvent(XEvent *event)
 
         case PropertyNotify:
         {
+            if (event->xproperty.atom == _glfw.x11.NET_FRAME_EXTENTS)
+            {
+                // The frame extents are read again the next time they are
+                // requested
+                window->x11.frameExtentsValid = GLFW_FALSE;
+                return;
+            }
+
             if (event->xproperty.state != PropertyNewValue)
                 return;
 
@@ -1833,6 +2464,50 @@ static void processEvent(XEvent *event)
     }
 }
 
+// Returns whether the specified event is pointer motion made redundant by the
+// next queued event, which is motion in the same window with the same state
+//
+static GLFWbool isMotionSuperseded(const XEvent* event)
+{
+    XEvent next;
+    _GLFWwindow* window = NULL;
+
+    if (event->type != MotionNotify || !QLength(_glfw.x11.display))
+        return GLFW_FALSE;
+
+    XPeekEvent(_glfw.x11.display, &next);
+    if (next.type != MotionNotify ||
+        next.xmotion.window != event->xmotion.window ||
+        next.xmotion.state != event->xmotion.state)
+    {
+        return GLFW_FALSE;
+    }
+
+    if (XFindContext(_glfw.x11.display,
+                     event->xmotion.window,
+                     _glfw.x11.context,
+                     (XPointer*) &window) != 0)
+    {
+        return GLFW_FALSE;
+    }
+
+    // Disabled cursor motion is measured from the previous event and the cursor
+    // history records every position, so neither may skip events
+    return window->cursorMode != GLFW_CURSOR_DISABLED && !window->motion.history;
+}
+
+// Flushes the output buffer if any requests have been made since the last flush
+//
+static void flushRequests(void)
+{
+    const unsigned long request = NextRequest(_glfw.x11.display);
+    if (request != _glfw.x11.flushedRequest)
+    {
+        XFlush(_glfw.x11.display);
+        _glfw.x11.flushedRequest = request;
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -1898,6 +2573,11 @@ void _glfwPushSelectionToManagerX11(void)
                     handleSelectionRequest(&event);
                     break;
 
+                case PropertyNotify:
+                case DestroyNotify:
+                    handleSelectionTransferEvent(&event);
+                    break;
+
                 case SelectionNotify:
                 {
                     if (event.xselection.target == _glfw.x11.SAVE_TARGETS)
@@ -2119,13 +2799,9 @@ void _glfwSetWindowIconX11(_GLFWwindow* window, int count, const GLFWimage* imag
             *target++ = images[i].width;
             *target++ = images[i].height;
 
-            for (int j = 0;  j < images[i].width * images[i].height;  j++)
-            {
-                *target++ = (((unsigned long) images[i].pixels[j * 4 + 0]) << 16) |
-                            (((unsigned long) images[i].pixels[j * 4 + 1]) <<  8) |
-                            (((unsigned long) images[i].pixels[j * 4 + 2]) <<  0) |
-                            (((unsigned long) images[i].pixels[j * 4 + 3]) << 24);
-            }
+            _glfwWidenPixels(target, images[i].pixels,
+                             images[i].width * images[i].height);
+            target += images[i].width * images[i].height;
         }
 
         // NOTE: XChangeProperty expects 32-bit values like the image data above to be
@@ -2154,16 +2830,22 @@ void _glfwSetWindowIconX11(_GLFWwindow* window, int count, const GLFWimage* imag
 
 void _glfwGetWindowPosX11(_GLFWwindow* window, int* xpos, int* ypos)
 {
-    Window dummy;
-    int x, y;
+    // The position is kept up to date by ConfigureNotify events, except that
+    // a requested position is reported until the window manager has replied
+    if (window->x11.positionRequested)
+    {
+        if (xpos)
+            *xpos = window->x11.requestedX;
+        if (ypos)
+            *ypos = window->x11.requestedY;
 
-    XTranslateCoordinates(_glfw.x11.display, window->x11.handle, _glfw.x11.root,
-                          0, 0, &x, &y, &dummy);
+        return;
+    }
 
     if (xpos)
-        *xpos = x;
+        *xpos = window->x11.xpos;
     if (ypos)
-        *ypos = y;
+        *ypos = window->x11.ypos;
 }
 
 void _glfwSetWindowPosX11(_GLFWwindow* window, int xpos, int ypos)
@@ -2188,17 +2870,19 @@ void _glfwSetWindowPosX11(_GLFWwindow* window, int xpos, int ypos)
 
     XMoveWindow(_glfw.x11.display, window->x11.handle, xpos, ypos);
     XFlush(_glfw.x11.display);
+
+    window->x11.positionRequested = GLFW_TRUE;
+    window->x11.requestedX = xpos;
+    window->x11.requestedY = ypos;
 }
 
 void _glfwGetWindowSizeX11(_GLFWwindow* window, int* width, int* height)
 {
-    XWindowAttributes attribs;
-    XGetWindowAttributes(_glfw.x11.display, window->x11.handle, &attribs);
-
+    // The size is kept up to date by ConfigureNotify events
     if (width)
-        *width = attribs.width;
+        *width = window->x11.width;
     if (height)
-        *height = attribs.height;
+        *height = window->x11.height;
 }
 
 void _glfwSetWindowSizeX11(_GLFWwindow* window, int width, int height)
@@ -2210,6 +2894,9 @@ void _glfwSetWindowSizeX11(_GLFWwindow* window, int width, int height)
     }
     else
     {
+        window->x11.requestedWidth = width;
+        window->x11.requestedHeight = height;
+
         if (!window->resizable)
             updateNormalHints(window, width, height);
 
@@ -2223,17 +2910,17 @@ void _glfwSetWindowSizeLimitsX11(_GLFWwindow* window,
                                  int minwidth, int minheight,
                                  int maxwidth, int maxheight)
 {
-    int width, height;
-    _glfwGetWindowSizeX11(window, &width, &height);
-    updateNormalHints(window, width, height);
+    updateNormalHints(window,
+                      window->x11.requestedWidth,
+                      window->x11.requestedHeight);
     XFlush(_glfw.x11.display);
 }
 
 void _glfwSetWindowAspectRatioX11(_GLFWwindow* window, int numer, int denom)
 {
-    int width, height;
-    _glfwGetWindowSizeX11(window, &width, &height);
-    updateNormalHints(window, width, height);
+    updateNormalHints(window,
+                      window->x11.requestedWidth,
+                      window->x11.requestedHeight);
     XFlush(_glfw.x11.display);
 }
 
@@ -2254,53 +2941,72 @@ void _glfwGetWindowFrameSizeX11(_GLFWwindow* window,
     if (_glfw.x11.NET_FRAME_EXTENTS == None)
         return;
 
-    if (!_glfwWindowVisibleX11(window) &&
-        _glfw.x11.NET_REQUEST_FRAME_EXTENTS)
+    if (!window->x11.frameExtentsValid)
     {
-        XEvent event;
-        double timeout = 0.5;
-
-        // Ensure _NET_FRAME_EXTENTS is set, allowing glfwGetWindowFrameSize to
-        // function before the window is mapped
-        sendEventToWM(window, _glfw.x11.NET_REQUEST_FRAME_EXTENTS,
-                      0, 0, 0, 0, 0);
-
-        // HACK: Use a timeout because earlier versions of some window managers
-        //       (at least Unity, Fluxbox and Xfwm) failed to send the reply
-        //       They have been fixed but broken versions are still in the wild
-        //       If you are affected by this and your window manager is NOT
-        //       listed above, PLEASE report it to their and our issue trackers
-        while (!XCheckIfEvent(_glfw.x11.display,
-                              &event,
-                              isFrameExtentsEvent,
-                              (XPointer) window))
+        if (!_glfwWindowVisibleX11(window) &&
+            _glfw.x11.NET_REQUEST_FRAME_EXTENTS)
         {
-            if (!waitForX11Event(&timeout))
+            XEvent event;
+            const uint64_t deadline = _glfwGetDeadline(0.5);
+
+            // Ensure _NET_FRAME_EXTENTS is set, allowing glfwGetWindowFrameSize
+            // to function before the window is mapped
+            sendEventToWM(window, _glfw.x11.NET_REQUEST_FRAME_EXTENTS,
+                          0, 0, 0, 0, 0);
+
+            // HACK: Use a timeout because earlier versions of some window
+            //       managers (at least Unity, Fluxbox and Xfwm) failed to send
+            //       the reply
+            //       They have been fixed but broken versions are still in the
+            //       wild
+            //       If you are affected by this and your window manager is NOT
+            //       listed above, PLEASE report it to their and our issue
+            //       trackers
+            while (!XCheckIfEvent(_glfw.x11.display,
+                                  &event,
+                                  isFrameExtentsEvent,
+                                  (XPointer) window))
             {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "X11: The window manager has a broken _NET_REQUEST_FRAME_EXTENTS implementation; please report this issue");
-                return;
+                if (!waitForX11Event(&deadline))
+                {
+                    _glfwInputError(GLFW_PLATFORM_ERROR,
+                                    "X11: The window manager has a broken _NET_REQUEST_FRAME_EXTENTS implementation; please report this issue");
+                    return;
+                }
             }
         }
-    }
 
-    if (_glfwGetWindowPropertyX11(window->x11.handle,
-                                  _glfw.x11.NET_FRAME_EXTENTS,
-                                  XA_CARDINAL,
-                                  (unsigned char**) &extents) == 4)
-    {
-        if (left)
-            *left = extents[0];
-        if (top)
-            *top = extents[2];
-        if (right)
-            *right = extents[1];
-        if (bottom)
-            *bottom = extents[3];
+        window->x11.frameLeft = 0;
+        window->x11.frameTop = 0;
+        window->x11.frameRight = 0;
+        window->x11.frameBottom = 0;
+
+        if (_glfwGetWindowPropertyX11(window->x11.handle,
+                                      _glfw.x11.NET_FRAME_EXTENTS,
+                                      XA_CARDINAL,
+                                      (unsigned char**) &extents) == 4)
+        {
+            window->x11.frameLeft = extents[0];
+            window->x11.frameTop = extents[2];
+            window->x11.frameRight = extents[1];
+            window->x11.frameBottom = extents[3];
+        }
+
+        if (extents)
+            XFree(extents);
+
+        // Any later change of the property invalidates the cached extents
+        window->x11.frameExtentsValid = GLFW_TRUE;
     }
 
-    if (extents)
-        XFree(extents);
+    if (left)
+        *left = window->x11.frameLeft;
+    if (top)
+        *top = window->x11.frameTop;
+    if (right)
+        *right = window->x11.frameRight;
+    if (bottom)
+        *bottom = window->x11.frameBottom;
 }
 
 void _glfwGetWindowContentScaleX11(_GLFWwindow* window, float* xscale, float* yscale)
@@ -2481,6 +3187,9 @@ void _glfwSetWindowMonitorX11(_GLFWwindow* window,
         }
         else
         {
+            window->x11.requestedWidth = width;
+            window->x11.requestedHeight = height;
+
             if (!window->resizable)
                 updateNormalHints(window, width, height);
 
@@ -2515,6 +3224,9 @@ void _glfwSetWindowMonitorX11(_GLFWwindow* window,
     }
     else
     {
+        window->x11.requestedWidth = width;
+        window->x11.requestedHeight = height;
+
         updateWindowMode(window);
         XMoveResizeWindow(_glfw.x11.display, window->x11.handle,
                           xpos, ypos, width, height);
@@ -2616,9 +3328,9 @@ GLFWbool _glfwFramebufferTransparentX11(_GLFWwindow* window)
 
 void _glfwSetWindowResizableX11(_GLFWwindow* window, GLFWbool enabled)
 {
-    int width, height;
-    _glfwGetWindowSizeX11(window, &width, &height);
-    updateNormalHints(window, width, height);
+    updateNormalHints(window,
+                      window->x11.requestedWidth,
+                      window->x11.requestedHeight);
 }
 
 void _glfwSetWindowDecoratedX11(_GLFWwindow* window, GLFWbool enabled)
@@ -2785,17 +3497,50 @@ void _glfwPollEventsX11(void)
 
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
+        _glfwProcessJoystickEventsLinux();
 #endif
-    XPending(_glfw.x11.display);
+    flushRequests();
+    XEventsQueued(_glfw.x11.display, QueuedAfterReading);
+
+    const int eventBudget = _glfw.hints.init.x11.eventBudget;
+    const uint64_t timeBudget = _glfw.hints.init.x11.eventTimeBudget > 0 ?
+        (uint64_t) _glfw.hints.init.x11.eventTimeBudget *
+        _glfwPlatformGetTimerFrequency() / 1000000 : 0;
+    const GLFWbool budgeted = eventBudget > 0 || timeBudget > 0;
+    const uint64_t start = timeBudget ? _glfwPlatformGetTimerValue() : 0;
+    int processed = 0;
 
     while (QLength(_glfw.x11.display))
     {
+        if (processed &&
+            ((eventBudget > 0 && processed >= eventBudget) ||
+             (timeBudget && _glfwPlatformGetTimerValue() - start >= timeBudget)))
+        {
+            // The remaining events stay queued and end the next wait at once
+            _GLFW_COUNT(GLFW_EVENTS_DEFERRED, QLength(_glfw.x11.display));
+            break;
+        }
+
         XEvent event;
         XNextEvent(_glfw.x11.display, &event);
+
+        if (budgeted && isMotionSuperseded(&event))
+        {
+            _GLFW_COUNT(GLFW_EVENTS_COALESCED, 1);
+            continue;
+        }
+
+        const Time time = getEventTime(&event);
+        if (time != CurrentTime)
+            _glfwInputEventTime(_glfwConvertEventTime(time));
+
         processEvent(&event);
+        _glfwInputEventTime(0);
+        processed++;
     }
 
+    _GLFW_COUNT(GLFW_EVENTS_PROCESSED, processed);
+
     _GLFWwindow* window = _glfw.x11.disabledCursorWindow;
     if (window)
     {
@@ -2811,18 +3556,53 @@ void _glfwPollEventsX11(void)
         }
     }
 
-    XFlush(_glfw.x11.display);
+    if (_glfw.waitFdCount)
+    {
+        const uint64_t deadline = 0;
+        GLFWbool ready;
+
+        _glfwPollWaitFdsPOSIX(NULL, 0, -1, &deadline, &ready);
+        _glfwInputWaitFds();
+    }
+
+    if (_glfw.x11.clipboardRequest.pending &&
+        _glfwPlatformGetTimerValue() >= _glfw.x11.clipboardRequest.deadline)
+    {
+        // The owner has stopped responding or exited during the transfer
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: Timed out waiting for the clipboard owner");
+        finishClipboardRequest(NULL);
+    }
+
+    flushRequests();
 }
 
 void _glfwWaitEventsX11(void)
 {
-    waitForAnyEvent(NULL);
+    // A pending clipboard request has to be abandoned on time
+    if (_glfw.x11.clipboardRequest.pending)
+        waitForAnyEvent(&_glfw.x11.clipboardRequest.deadline);
+    else
+        waitForAnyEvent(NULL);
+
     _glfwPollEventsX11();
 }
 
 void _glfwWaitEventsTimeoutX11(double timeout)
 {
-    waitForAnyEvent(&timeout);
+    _glfwWaitEventsUntilX11(_glfwGetDeadline(timeout));
+}
+
+void _glfwWaitEventsUntilX11(uint64_t deadline)
+{
+    // A pending clipboard request has to be abandoned on time
+    if (_glfw.x11.clipboardRequest.pending &&
+        _glfw.x11.clipboardRequest.deadline < deadline)
+    {
+        deadline = _glfw.x11.clipboardRequest.deadline;
+    }
+
+    waitForAnyEvent(&deadline);
     _glfwPollEventsX11();
 }
 
@@ -3060,12 +3840,10 @@ void _glfwSetCursorX11(_GLFWwindow* window, _GLFWcursor* cursor)
     }
 }
 
-void _glfwSetClipboardStringX11(const char* string)
+// Makes the helper window the owner of the clipboard selection
+//
+static void acquireClipboard(void)
 {
-    char* copy = _glfw_strdup(string);
-    _glfw_free(_glfw.x11.clipboardString);
-    _glfw.x11.clipboardString = copy;
-
     XSetSelectionOwner(_glfw.x11.display,
                        _glfw.x11.CLIPBOARD,
                        _glfw.x11.helperWindowHandle,
@@ -3079,11 +3857,207 @@ void _glfwSetClipboardStringX11(const char* string)
     }
 }
 
+void _glfwSetClipboardStringX11(const char* string)
+{
+    char* copy = _glfw_strdup(string);
+    detachSelectionTransfers();
+    _glfw_free(_glfw.x11.clipboardString);
+    _glfw.x11.clipboardString = copy;
+
+    acquireClipboard();
+}
+
 const char* _glfwGetClipboardStringX11(void)
 {
     return getSelectionString(_glfw.x11.CLIPBOARD);
 }
 
+void _glfwRequestClipboardStringX11(void)
+{
+    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) ==
+        _glfw.x11.helperWindowHandle)
+    {
+        _glfwInputClipboardString(_glfw.x11.clipboardString);
+        return;
+    }
+
+    // A transfer already in progress will call the new callback when done
+    if (_glfw.x11.clipboardRequest.pending)
+        return;
+
+    _glfw.x11.clipboardRequest.pending = GLFW_TRUE;
+    convertClipboardRequest(_glfw.x11.UTF8_STRING);
+    XFlush(_glfw.x11.display);
+}
+
+GLFWbool _glfwSetClipboardDataX11(void)
+{
+    Atom* atoms = _glfw_calloc(_glfw.clipboard.count, sizeof(Atom));
+    if (!atoms)
+        return GLFW_FALSE;
+
+    // The string functions are served from the UTF-8 text item, if any
+    char* string = NULL;
+    if (_glfwFindClipboardItem("text/plain;charset=utf-8"))
+    {
+        string = _glfwCopyClipboardItemString();
+        if (!string)
+        {
+            _glfw_free(atoms);
+            return GLFW_FALSE;
+        }
+    }
+
+    XInternAtoms(_glfw.x11.display,
+                 (char**) _glfw.clipboard.types,
+                 _glfw.clipboard.count,
+                 False,
+                 atoms);
+
+    // The previous items are freed after this returns
+    detachSelectionTransfers();
+
+    _glfw_free(_glfw.x11.clipboardString);
+    _glfw.x11.clipboardString = string;
+
+    _glfw_free(_glfw.x11.clipboardAtoms);
+    _glfw.x11.clipboardAtoms = atoms;
+
+    acquireClipboard();
+    return GLFW_TRUE;
+}
+
+void _glfwFreeClipboardTypesX11(void)
+{
+    for (int i = 0;  i < _glfw.x11.clipboardTypeCount;  i++)
+    {
+        if (_glfw.x11.clipboardTypes[i])
+            XFree(_glfw.x11.clipboardTypes[i]);
+    }
+
+    _glfw_free(_glfw.x11.clipboardTypes);
+    _glfw.x11.clipboardTypes = NULL;
+    _glfw.x11.clipboardTypeCount = 0;
+}
+
+const char** _glfwGetClipboardTypesX11(int* count)
+{
+    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) ==
+        _glfw.x11.helperWindowHandle)
+    {
+        static const char* textTypes[] = { "UTF8_STRING", "STRING" };
+
+        if (_glfw.clipboard.count)
+        {
+            *count = _glfw.clipboard.count;
+            return _glfw.clipboard.types;
+        }
+
+        if (_glfw.x11.clipboardString)
+        {
+            *count = sizeof(textTypes) / sizeof(textTypes[0]);
+            return textTypes;
+        }
+
+        return NULL;
+    }
+
+    _glfwFreeClipboardTypesX11();
+
+    XEvent notification;
+    if (!convertSelection(_glfw.x11.CLIPBOARD, _glfw.x11.TARGETS, &notification))
+        return NULL;
+
+    Atom* targets;
+    const unsigned long targetCount =
+        _glfwGetWindowPropertyX11(notification.xselection.requestor,
+                                  notification.xselection.property,
+                                  XA_ATOM,
+                                  (unsigned char**) &targets);
+
+    XDeleteProperty(_glfw.x11.display,
+                    notification.xselection.requestor,
+                    notification.xselection.property);
+
+    if (!targetCount)
+    {
+        if (targets)
+            XFree(targets);
+
+        return NULL;
+    }
+
+    char** names = _glfw_calloc(targetCount, sizeof(char*));
+    if (!names)
+    {
+        XFree(targets);
+        return NULL;
+    }
+
+    // The owner may list atoms that do not exist
+    _glfwGrabErrorHandlerX11();
+    XGetAtomNames(_glfw.x11.display, targets, (int) targetCount, names);
+    _glfwReleaseErrorHandlerX11();
+
+    XFree(targets);
+
+    if (_glfw.x11.errorCode != Success)
+    {
+        _glfwInputErrorX11(GLFW_PLATFORM_ERROR,
+                           "X11: Failed to retrieve clipboard target names");
+
+        for (unsigned long i = 0;  i < targetCount;  i++)
+        {
+            if (names[i])
+                XFree(names[i]);
+        }
+
+        _glfw_free(names);
+        return NULL;
+    }
+
+    _glfw.x11.clipboardTypes = names;
+    _glfw.x11.clipboardTypeCount = (int) targetCount;
+
+    *count = _glfw.x11.clipboardTypeCount;
+    return (const char**) _glfw.x11.clipboardTypes;
+}
+
+GLFWbool _glfwReadClipboardDataX11(const char* type,
+                                   GLFWclipboarddatafun callback,
+                                   void* user)
+{
+    const Atom target = XInternAtom(_glfw.x11.display, type, False);
+
+    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) ==
+        _glfw.x11.helperWindowHandle)
+    {
+        const char* data;
+        size_t size;
+
+        // The data is passed on directly instead of through a window property
+        if (getOwnedSelectionData(_glfw.x11.CLIPBOARD, target, &data, &size))
+        {
+            callback(data, size, user);
+            return GLFW_TRUE;
+        }
+    }
+    else
+    {
+        XEvent notification;
+
+        if (convertSelection(_glfw.x11.CLIPBOARD, target, &notification) &&
+            readSelectionData(&notification, target, callback, user))
+        {
+            return GLFW_TRUE;
+        }
+    }
+
+    _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                    "X11: Failed to convert clipboard to %s", type);
+    return GLFW_FALSE;
+}
+
 EGLenum _glfwGetEGLPlatformX11(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
@@ -3328,6 +4302,7 @@ GLFWAPI void glfwSetX11SelectionString(const char* string)
         return;
     }
 
+    detachSelectionTransfers();
     _glfw_free(_glfw.x11.primarySelectionString);
     _glfw.x11.primarySelectionString = _glfw_strdup(string);
 
@@ -0,0 +1,182 @@
+//========================================================================
+// Event wait jitter test
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test paces a loop with a fixed period by waiting for events until the
+// start of each period, and reports how late each wakeup was
+//
+// It can compare waiting until an absolute deadline with waiting with
+// a relative timeout, and counts the waits that returned before the deadline
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static void usage(void)
+{
+    printf("Usage: jitter [-h] [-t] [-n PERIODS] [-p MICROSECONDS]\n");
+    printf("Options:\n");
+    printf("  -t wait with a relative timeout instead of until a deadline\n");
+    printf("  -n the number of periods to measure\n");
+    printf("  -p the length of each period in microseconds\n");
+    printf("  -h show this help\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static int compare_ticks(const void* first, const void* second)
+{
+    const uint64_t a = *((const uint64_t*) first);
+    const uint64_t b = *((const uint64_t*) second);
+    return (a > b) - (a < b);
+}
+
+int main(int argc, char** argv)
+{
+    int ch, i;
+    int relative = GLFW_FALSE;
+    int early = 0;
+    int count = 1000;
+    int period = 1000;
+    uint64_t frequency, ticks, deadline;
+    uint64_t* samples;
+    double scale;
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "htn:p:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 't':
+                relative = GLFW_TRUE;
+                break;
+            case 'n':
+                count = atoi(optarg);
+                break;
+            case 'p':
+                period = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (count < 1 || period < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+
+    window = glfwCreateWindow(640, 480, "Event Wait Jitter Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    samples = calloc(count, sizeof(uint64_t));
+    frequency = glfwGetTimerFrequency();
+    ticks = (uint64_t) period * frequency / 1000000;
+    scale = 1e6 / (double) frequency;
+
+    printf("Waiting %s for %i periods of %i us\n",
+           relative ? "with timeout" : "until deadline", count, period);
+
+    deadline = glfwGetTimerValue();
+
+    for (i = 0;  i < count && !glfwWindowShouldClose(window);  i++)
+    {
+        uint64_t now;
+
+        deadline += ticks;
+
+        now = glfwGetTimerValue();
+        if (now < deadline)
+        {
+            if (relative)
+                glfwWaitEventsTimeout((deadline - now) / (double) frequency);
+            else
+                glfwWaitEventsUntil(deadline);
+
+            now = glfwGetTimerValue();
+        }
+
+        // A wait that returns early is counted rather than repeated, so that
+        // a broken deadline shows up instead of becoming a busy loop
+        if (now < deadline)
+        {
+            early++;
+            samples[i] = 0;
+        }
+        else
+            samples[i] = now - deadline;
+    }
+
+    count = i;
+
+    if (!count)
+    {
+        free(samples);
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    qsort(samples, count, sizeof(uint64_t), compare_ticks);
+
+    printf("%10s %10s %10s %10s %10s\n", "p50", "p90", "p99", "p99.9", "max");
+    printf("%10.1f %10.1f %10.1f %10.1f %10.1f (us late)\n",
+           samples[count / 2] * scale,
+           samples[count * 9 / 10] * scale,
+           samples[count * 99 / 100] * scale,
+           samples[count * 999 / 1000] * scale,
+           samples[count - 1] * scale);
+    printf("%i of %i waits returned early\n", early, count);
+
+    free(samples);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
+